@@ -0,0 +1,328 @@
+/*
+-----------------------------------------------------------------------------
+ File: chainedClientStorage.cpp
+ Description: Implementation of ChainedClientStorage, the chained policy.
+              Uses separate chaining for collision resolution and provides
+              O(1) average case lookup time for client retrieval. While a
+              resize is in progress, buckets below rehashIndex of the old
+              array have already moved; lookups check the new array and,
+              for IDs whose old bucket has not moved yet, the old one.
+ Author: Sharjeel Khan
+ Assumptions: Client IDs are distributed reasonably well across hash range
+              Memory allocation succeeds for new nodes
+              Data format is "ID lastName firstName" with spaces
+ -----------------------------------------------------------------------------
+*/
+
+#include "chainedClientStorage.h"
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+// Constants
+// Bucket counts: primes, each the first above twice the one before
+const size_t TABLE_SIZES[] = {
+    1009, 2027, 4057, 8117, 16249, 32503, 65011, 130027, 260081, 520193,
+    1040387, 2080777, 4161557, 8323151, 16646317, 33292687, 66585377,
+    133170769, 266341583, 532683227, 1065366479, 2130732959
+};
+const size_t TABLE_SIZE_COUNT = sizeof(TABLE_SIZES) / sizeof(TABLE_SIZES[0]);
+
+// ----------------------------------------------------------------------------
+// Default Constructor
+// Initializes hash table.Empty hash table ready for insertions
+ChainedClientStorage::ChainedClientStorage()
+    : table(allocateBuckets(TABLE_SIZES[0])), tableSize(TABLE_SIZES[0]),
+      oldTable(nullptr), oldTableSize(0), rehashIndex(0), count(0) {
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Cleans up all hash table resources
+ChainedClientStorage::~ChainedClientStorage() {
+    clear();
+    free(table);
+}
+
+// ----------------------------------------------------------------------------
+// hashFunction
+// Computes hash value for client ID using modulo operation
+// Returns hash value in valid table range [0, size-1]
+size_t ChainedClientStorage::hashFunction(ClientID id, size_t size) const {
+    // Simple modulo hash - works well for sequential IDs with prime table size
+    return (uint64_t)id % size;
+}
+
+// ----------------------------------------------------------------------------
+// findLink
+// Searches the current array, then the not yet moved part of the old one
+// Returns link pointing at id's node, or nullptr if id is absent
+ChainedClientStorage::HashNode** ChainedClientStorage::findLink(ClientID id) const {
+    HashNode** link = &table[hashFunction(id, tableSize)];
+    while (*link != nullptr) {
+        if ((*link)->data->getID() == id) {
+            return link;
+        }
+        link = &(*link)->next;
+    }
+
+    if (oldTable != nullptr) {
+        size_t oldBucket = hashFunction(id, oldTableSize);
+        if (oldBucket >= rehashIndex) {
+            link = &oldTable[oldBucket];
+            while (*link != nullptr) {
+                if ((*link)->data->getID() == id) {
+                    return link;
+                }
+                link = &(*link)->next;
+            }
+        }
+    }
+    return nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// insert
+// Inserts client into appropriate hash bucket of the current array
+// Client inserted if not duplicate, hash table updated
+bool ChainedClientStorage::insert(Client* client) {
+    if (client == nullptr) {
+        return false;
+    }
+    if (findLink(client->getID()) != nullptr) {
+        return false; // Duplicate ID found, don't insert
+    }
+
+    rehashStep(REHASH_STEP);
+    growIfNeeded();
+
+    // Insert at beginning of chain
+    size_t hashValue = hashFunction(client->getID(), tableSize);
+    HashNode* newNode = new HashNode(client);
+    newNode->next = table[hashValue];
+    table[hashValue] = newNode;
+    count++;
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// retrieve
+// Searches for client by ID in hash table
+//found points to matching Client or nullptr, returns success status
+bool ChainedClientStorage::retrieve(ClientID id, Client*& found) const {
+    HashNode** link = findLink(id);
+    if (link == nullptr) {
+        found = nullptr;
+        return false;
+    }
+    found = (*link)->data;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// remove
+// Removes client with specified ID from hash table
+//Client removed and deallocated if found
+bool ChainedClientStorage::remove(ClientID id) {
+    HashNode** link = findLink(id);
+    if (link == nullptr) {
+        return false; // Client not found
+    }
+
+    HashNode* current = *link;
+    *link = current->next;
+    delete current->data;  // Delete the client object
+    delete current;        // Delete the hash node
+    count--;
+
+    rehashStep(REHASH_STEP);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// growIfNeeded
+// Once clients outnumber buckets, the current array becomes the old one and
+// a larger array takes its place; a resize still in progress is finished
+// first so at most two arrays exist
+void ChainedClientStorage::growIfNeeded() {
+    if (count + 1 <= tableSize) {
+        return;
+    }
+    size_t next = 0;
+    while (next < TABLE_SIZE_COUNT && TABLE_SIZES[next] <= tableSize) {
+        next++;
+    }
+    if (next == TABLE_SIZE_COUNT) {
+        return;               // Largest size reached, chains just grow
+    }
+
+    if (oldTable != nullptr) {
+        rehashStep(oldTableSize);
+    }
+    resizes.push_back(Resize{tableSize, TABLE_SIZES[next], count});
+    oldTable = table;
+    oldTableSize = tableSize;
+    rehashIndex = 0;
+    table = allocateBuckets(TABLE_SIZES[next]);
+    tableSize = TABLE_SIZES[next];
+}
+
+// ----------------------------------------------------------------------------
+// rehashStep
+// Relinks every node of the next steps old buckets into the current array
+// Old array freed once all of its buckets have moved
+void ChainedClientStorage::rehashStep(size_t steps) {
+    if (oldTable == nullptr) {
+        return;
+    }
+    for (; steps > 0 && rehashIndex < oldTableSize; --steps, ++rehashIndex) {
+        HashNode* node = oldTable[rehashIndex];
+        while (node != nullptr) {
+            HashNode* next = node->next;
+            size_t hashValue = hashFunction(node->data->getID(), tableSize);
+            node->next = table[hashValue];
+            table[hashValue] = node;
+            node = next;
+        }
+        oldTable[rehashIndex] = nullptr;
+    }
+
+    if (rehashIndex == oldTableSize) {
+        free(oldTable);
+        oldTable = nullptr;
+        oldTableSize = 0;
+        rehashIndex = 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// allocateBuckets
+// calloc hands large arrays over as untouched zero pages, so growing does
+// not stall clearing the whole new array; pages are faulted in as used
+// Returns array of size empty bucket heads, released with free
+ChainedClientStorage::HashNode** ChainedClientStorage::allocateBuckets(size_t size) {
+    HashNode** buckets = (HashNode**)calloc(size, sizeof(HashNode*));
+    if (buckets == nullptr) {
+        throw bad_alloc();
+    }
+    return buckets;
+}
+
+// ----------------------------------------------------------------------------
+// collectAll
+// Walks buckets in order, each chain from head to tail, then the buckets
+// of the old array that have not moved yet
+// All clients appended to found in the same order display shows them
+void ChainedClientStorage::collectAll(vector<Client*>& found) const {
+    for (size_t i = 0; i < tableSize; ++i) {
+        for (HashNode* current = table[i]; current != nullptr; current = current->next) {
+            found.push_back(current->data);
+        }
+    }
+    for (size_t i = rehashIndex; oldTable != nullptr && i < oldTableSize; ++i) {
+        for (HashNode* current = oldTable[i]; current != nullptr; current = current->next) {
+            found.push_back(current->data);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// display
+// Displays all clients in hash table bucket order
+// All clients displayed with their information
+void ChainedClientStorage::display(OutputSink& out) const {
+    vector<Client*> all;
+    collectAll(all);
+    for (const Client* client : all) {
+        client->display(out);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// size
+// Returns number of clients in both arrays
+size_t ChainedClientStorage::size() const {
+    return count;
+}
+
+// ----------------------------------------------------------------------------
+// displayStats
+// Shows hash table statistics for analysis; chains of the old array count
+// while a resize is in progress
+// Bucket usage statistics and resize history displayed
+void ChainedClientStorage::displayStats(OutputSink& out) const {
+    size_t usedBuckets = 0;
+    size_t maxChainLength = 0;
+    HashNode** arrays[] = {table, oldTable};
+    size_t starts[] = {0, rehashIndex};
+    size_t ends[] = {tableSize, oldTableSize};
+
+    for (int a = 0; a < 2; ++a) {
+        for (size_t i = starts[a]; arrays[a] != nullptr && i < ends[a]; ++i) {
+            size_t chainLength = 0;
+            for (HashNode* current = arrays[a][i]; current != nullptr; current = current->next) {
+                chainLength++;
+            }
+            if (chainLength > 0) {
+                usedBuckets++;
+            }
+            if (chainLength > maxChainLength) {
+                maxChainLength = chainLength;
+            }
+        }
+    }
+
+    out << "Hash Table Statistics:\n";
+    out << "Total buckets: " << tableSize << '\n';
+    out << "Used buckets: " << usedBuckets << '\n';
+    out << "Total clients: " << count << '\n';
+    out << "Max chain length: " << maxChainLength << '\n';
+    if (count > 0) {
+        out << "Load factor: " << (double)count / tableSize << '\n';
+    }
+    out << "Resizes: " << resizes.size() << '\n';
+    for (const Resize& resize : resizes) {
+        out << "  " << resize.fromBuckets << " -> " << resize.toBuckets
+            << " buckets at " << resize.clients << " clients\n";
+    }
+    if (oldTable != nullptr) {
+        out << "Rehash in progress: " << rehashIndex << " of " << oldTableSize
+            << " old buckets moved\n";
+    }
+}
+
+// ----------------------------------------------------------------------------
+// clear
+// Removes all elements from hash table
+// All clients and nodes deallocated, table reset to empty
+void ChainedClientStorage::clear() {
+    for (size_t i = 0; i < tableSize; ++i) {
+        clearChain(table[i]);
+        table[i] = nullptr;
+    }
+    if (oldTable != nullptr) {
+        for (size_t i = rehashIndex; i < oldTableSize; ++i) {
+            clearChain(oldTable[i]);
+        }
+        free(oldTable);
+        oldTable = nullptr;
+        oldTableSize = 0;
+        rehashIndex = 0;
+    }
+    count = 0;
+}
+
+// ----------------------------------------------------------------------------
+// clearChain
+// Iteratively deallocates all nodes in a hash chain
+// All nodes in chain deallocated including client objects
+void ChainedClientStorage::clearChain(HashNode* node) {
+    while (node != nullptr) {
+        HashNode* next = node->next;
+        delete node->data;  // Delete the client object
+        delete node;        // Delete the hash node
+        node = next;
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ -----------------------------------------------------------------------------
+ File: chainedClientStorage.h
+ Description: Chained storage policy for ClientHash. Uses
+              client ID as hash key for O(1) average lookup time.
+              Implements separate chaining for collision resolution. The
+              bucket array grows to the next prime about twice its size
+              once it averages a client per bucket; clients move to the
+              new array a few buckets per insert or remove, so no single
+              operation pays for a full rehash.
+ Author: Sharjeel Khan
+ Assumptions: Client IDs are positive 64-bit integers
+              Hash function distributes IDs reasonably well
+              Data format is "ID lastName firstName" with spaces
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef CHAINED_CLIENT_STORAGE_H
+#define CHAINED_CLIENT_STORAGE_H
+
+#include "client.h"
+#include <vector>
+
+class ChainedClientStorage {
+public:
+    // Single-threaded storage, reads need no protection
+    struct ReadGuard {
+        explicit ReadGuard(const ChainedClientStorage&) {}
+    };
+
+    // Default Constructor
+    ChainedClientStorage();
+    
+
+    // Destructor
+    ~ChainedClientStorage();
+
+    // Inserts client into hash table using ID as key
+    bool insert(Client* client);
+    
+    // Finds client by ID in hash table
+    bool retrieve(ClientID id, Client*& found) const;
+
+    // Removes client with specified ID from hash table
+    bool remove(ClientID id);
+
+    // Appends every client to found in hash table order
+    void collectAll(vector<Client*>& found) const;
+
+    // Appends all clients to out in hash table order (no heading)
+    void display(OutputSink& out) const;
+
+    // Returns number of clients stored
+    size_t size() const;
+
+    // Appends hash table statistics, including every resize, to out for
+    // debugging/analysis
+    void displayStats(OutputSink& out) const;
+
+    // Removes all elements from hash table
+    void clear();
+
+private:
+    // Hash table node for separate chaining
+    struct HashNode {
+        Client* data;                 // Pointer to client object
+        HashNode* next;               // Next node in chain
+        
+        HashNode(Client* client) : data(client), next(nullptr) {}
+    };
+
+    // One completed or in-progress growth of the bucket array
+    struct Resize {
+        size_t fromBuckets;           // Buckets before
+        size_t toBuckets;             // Buckets after
+        size_t clients;               // Clients when it started
+    };
+
+    static const size_t REHASH_STEP = 4;  // Old buckets moved per operation
+
+    HashNode** table;                 // Array of hash bucket heads
+    size_t tableSize;                 // Buckets in table, a prime
+    HashNode** oldTable;              // Buckets still being moved, or nullptr
+    size_t oldTableSize;              // Buckets in oldTable
+    size_t rehashIndex;               // Old buckets below this are empty
+    size_t count;                     // Clients in both arrays
+    vector<Resize> resizes;           // Growth history, oldest first
+
+    // Computes hash value for given client ID in a table of size buckets
+    size_t hashFunction(ClientID id, size_t size) const;
+
+    // Returns pointer to the link that points at id's node (or at the
+    // nullptr ending its chain), searching whichever array holds it
+    HashNode** findLink(ClientID id) const;
+
+    // Starts moving clients to a larger array if the load limit is passed
+    void growIfNeeded();
+
+    // Moves up to REHASH_STEP old buckets into table, freeing oldTable
+    // once the last one is moved
+    void rehashStep(size_t steps);
+
+    // Allocates size empty buckets
+    static HashNode** allocateBuckets(size_t size);
+
+    // Iteratively clears a single hash chain
+    void clearChain(HashNode* node);
+
+    // Tables own their clients, copying is not supported
+    ChainedClientStorage(const ChainedClientStorage&) = delete;
+    ChainedClientStorage& operator=(const ChainedClientStorage&) = delete;
+};
+
+#endif // CHAINED_CLIENT_STORAGE_H
+
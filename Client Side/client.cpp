@@ -10,25 +10,26 @@
  -----------------------------------------------------------------------------
 */
 #include "client.h"
-#include <iomanip>
 
 using namespace std;
 
 // Constants
 const int DEFAULT_ID = 0;
-const int ID_DISPLAY_WIDTH = 4;
+const int ID_DISPLAY_WIDTH = 4;           // Minimum, longer IDs print in full
 
 // ----------------------------------------------------------------------------
 // Default Constructor
 // Initializes client with default values
-Client::Client() : id(DEFAULT_ID), firstName(""), lastName("") {
+Client::Client()
+    : id(DEFAULT_ID), firstName(ClientNamePool::EMPTY_NAME), lastName(ClientNamePool::EMPTY_NAME) {
 }
 
 // ----------------------------------------------------------------------------
 // Parameterized Constructor  
-// Creates client with specified ID and names
-Client::Client(int id, const string& first, const string& last)
-    : id(id), firstName(first), lastName(last) {
+// Creates client with specified ID, interning both names
+Client::Client(ClientID id, string_view first, string_view last)
+    : id(id), firstName(ClientNamePool::getDefault().intern(first)),
+      lastName(ClientNamePool::getDefault().intern(last)) {
 }
 
 // ----------------------------------------------------------------------------
@@ -40,7 +41,7 @@ Client::~Client() {
 // ----------------------------------------------------------------------------
 // getID
 // Returns the client's unique identifier
-int Client::getID() const {
+ClientID Client::getID() const {
     return id;
 }
 
@@ -48,25 +49,36 @@ int Client::getID() const {
 // getFirstName
 // Returns the client's first name
 // Pre: Object is properly initialized
-// Post: Returns current first name string (may be empty)
-string Client::getFirstName() const {
-    return firstName;
+// Post: Returns view of current first name (may be empty)
+string_view Client::getFirstName() const {
+    return ClientNamePool::getDefault().view(firstName);
 }
 
 // ----------------------------------------------------------------------------
 // getLastName
 // Returns the client's last name incase client doesn't have first name
-string Client::getLastName() const {
+string_view Client::getLastName() const {
+    return ClientNamePool::getDefault().view(lastName);
+}
+
+// ----------------------------------------------------------------------------
+// getFirstNameHandle / getLastNameHandle
+// Returns pool handles of the names
+ClientNamePool::Handle Client::getFirstNameHandle() const {
+    return firstName;
+}
+
+ClientNamePool::Handle Client::getLastNameHandle() const {
     return lastName;
 }
 
 // ----------------------------------------------------------------------------
 // setData
 // Sets all client information at once,updates cleint data with new values
-void Client::setData(int id, const string& first, const string& last) {
+void Client::setData(ClientID id, string_view first, string_view last) {
     this->id = id;
-    this->firstName = first;
-    this->lastName = last;
+    this->firstName = ClientNamePool::getDefault().intern(first);
+    this->lastName = ClientNamePool::getDefault().intern(last);
 }
 
 // ----------------------------------------------------------------------------
@@ -89,11 +101,11 @@ bool Client::operator==(const Client& other) const {
 // display
 // Outputs client information in assignment-specified format
 // Client data displayed as "ID lastName, firstName" or "ID lastName"
-void Client::display() const {
-    cout << setw(ID_DISPLAY_WIDTH) << id << " ";
-    if (firstName.empty()) {
-        cout << lastName << endl;
+void Client::display(OutputSink& out) const {
+    out.writeRight(id, ID_DISPLAY_WIDTH) << ' ';
+    if (firstName == ClientNamePool::EMPTY_NAME) {
+        out << getLastName() << '\n';
     } else {
-        cout << lastName << ", " << firstName << endl;
+        out << getLastName() << ", " << getFirstName() << '\n';
     }
 }
\ No newline at end of file
@@ -3,9 +3,13 @@
  File: client.h
  Description: Client class representing library patrons. Stores client ID,
               first name, and last name. Supports comparison operations for
-              sorting and searching in data structures.
+              sorting and searching in data structures. Names are interned
+              in the shared ClientNamePool and held as 32-bit handles, so a
+              Client is 16 bytes with no allocation of its own.
  Author: Sharjeel Khan
- Assumptions: Client IDs are unique 4-digit integers
+ Assumptions: Client IDs are unique positive 64-bit integers
+              Names returned by the accessors view pool storage and stay
+              valid for the life of the process
               Data format is "ID lastName firstName" with spaces between fields
               Some clients may have only lastName (no firstName)
 -----------------------------------------------------------------------------
@@ -13,11 +17,19 @@
 #ifndef CLIENT_H
 #define CLIENT_H
 
+#include "clientNamePool.h"
+#include "outputSink.h"
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <iostream>
 
 using namespace std;
 
+// Client identifier; IDs below MIN_CLIENT_ID are rejected by commands
+using ClientID = int64_t;
+const ClientID MIN_CLIENT_ID = 1;
+
 class Client {
 public:
     // Default Constructor
@@ -25,22 +37,33 @@ public:
     Client();
     
     // Parameterized Constructor
-    // Creates client with specified ID and names
-    Client(int id, const string& firstName, const string& lastName);
+    // Creates client with specified ID and names (interned, not copied
+    // into the client)
+    Client(ClientID id, string_view firstName, string_view lastName);
     
     // Destructor
     // Cleans up client object resources
     ~Client();
 
+    // Copy and move; tables that store clients by value move them
+    Client(const Client& other) = default;
+    Client(Client&& other) = default;
+    Client& operator=(const Client& other) = default;
+    Client& operator=(Client&& other) = default;
+
    
-    // Accessor methods
-    int getID() const;
-    string getFirstName() const;
-    string getLastName() const;
+    // Accessor methods; names are views into the name pool
+    ClientID getID() const;
+    string_view getFirstName() const;
+    string_view getLastName() const;
+
+    // Pool handles of the names; equal handles mean equal names
+    ClientNamePool::Handle getFirstNameHandle() const;
+    ClientNamePool::Handle getLastNameHandle() const;
     
 
     // setData
-    void setData(int id, const string& firstName, const string& lastName);
+    void setData(ClientID id, string_view firstName, string_view lastName);
    
     // Compares clients for sorting by ID
     bool operator<(const Client& other) const;
@@ -48,13 +71,13 @@ public:
     // Compares clients for equality by ID
     bool operator==(const Client& other) const;
 
-    // Outputs client information in formatted manner
-    void display() const;
+    // Appends client information to out in formatted manner
+    void display(OutputSink& out) const;
 
 private:
-    int id;                           // Unique 4-digit client identifier
-    string firstName;                 // Client's first name (may be empty)
-    string lastName;                  // Client's last name
+    ClientID id;                      // Unique client identifier
+    ClientNamePool::Handle firstName; // Client's first name (may be empty)
+    ClientNamePool::Handle lastName;  // Client's last name
 };
 
 #endif // CLIENT_H
\ No newline at end of file
@@ -1,12 +1,21 @@
 /*
  -----------------------------------------------------------------------------
  File: clientHash.h
- Description: Custom hash table implementation for Client objects. Uses
-              4-digit client ID as hash key for O(1) average lookup time.
-              Implements separate chaining for collision resolution.
+ Description: Custom hash table for Client objects, keyed by client ID and
+              parameterized on how the clients are stored. The Storage
+              policy is chosen at compile time, so every call (retrieve in
+              particular) is a direct, inlinable call with no virtual
+              dispatch. Policies shipped with the library:
+                DirectClientStorage  - one slot per 4-digit ID, one load
+                ChainedClientStorage - separate chaining, grows incrementally
+                FlatClientStorage    - open addressing with group probing
+                ConcurrentClientStorage - lock-free lookups, striped writers
+                CompactClientStorage - 16-byte clients in one probed array
  Author: Sharjeel Khan
- Assumptions: Client IDs are 4-digit integers (1000-9999)
-              Hash function distributes IDs reasonably well
+ Assumptions: Storage provides insert, retrieve, remove, collectAll,
+              display (clients only), displayStats, size and clear with
+              the signatures used below, and a ReadGuard type constructible
+              from const Storage&
               Data format is "ID lastName firstName" with spaces
  -----------------------------------------------------------------------------
 */
@@ -15,52 +24,74 @@
 #define CLIENT_HASH_H
 
 #include "client.h"
+#include "chainedClientStorage.h"
+#include "compactClientStorage.h"
+#include "concurrentClientStorage.h"
+#include "directClientStorage.h"
+#include "flatClientStorage.h"
+#include <vector>
 
+template <typename Storage>
 class ClientHash {
 public:
-    // Default Constructor
-    ClientHash();
-    
+    // Read section of Storage; clients found by retrieve stay valid while
+    // a guard is in scope
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const ClientHash& table) : guard(table.storage) {}
 
-    // Destructor
-    ~ClientHash();
+    private:
+        typename Storage::ReadGuard guard;
+    };
+
+    // Inserts client into hash table using ID as key; on success the
+    // table owns the client (Storage may move it and delete the object)
+    bool insert(Client* client) {
+        return storage.insert(client);
+    }
 
-    // Inserts client into hash table using ID as key
-    bool insert(Client* client);
-    
     // Finds client by ID in hash table
-    bool retrieve(int id, Client*& found) const;
+    bool retrieve(ClientID id, Client*& found) const {
+        return storage.retrieve(id, found);
+    }
 
     // Removes client with specified ID from hash table
-    bool remove(int id);
+    bool remove(ClientID id) {
+        return storage.remove(id);
+    }
 
-    // Displays all clients in hash table order
-    void display() const;
+    // Appends every client to found in display order
+    void collectAll(vector<Client*>& found) const {
+        storage.collectAll(found);
+    }
 
-    // Shows hash table statistics for debugging/analysis
-    void displayStats() const;
+    // Appends all clients to out in Storage order
+    void display(OutputSink& out) const {
+        out << "CLIENT HASH TABLE CONTENTS:\n";
+        out << "===========================\n";
+        storage.display(out);
+        if (storage.size() == 0) {
+            out << "No clients in hash table.\n";
+        }
+    }
 
-    // Removes all elements from hash table
-    void clear();
+    // Appends Storage statistics to out for debugging/analysis
+    void displayStats(OutputSink& out) const {
+        storage.displayStats(out);
+    }
 
-private:
-    // Hash table node for separate chaining
-    struct HashNode {
-        Client* data;                 // Pointer to client object
-        HashNode* next;               // Next node in chain
-        
-        HashNode(Client* client) : data(client), next(nullptr) {}
-    };
+    // Returns number of clients in hash table
+    size_t size() const {
+        return storage.size();
+    }
 
-    static const int TABLE_SIZE = 1009;  // Prime number for better distribution
-    HashNode* table[TABLE_SIZE];          // Array of hash bucket heads
+    // Removes all elements from hash table
+    void clear() {
+        storage.clear();
+    }
 
-    // Computes hash value for given client ID
-    int hashFunction(int id) const;
-    
-    // Recursively clears a single hash chain
-    void clearChain(HashNode* node);
+private:
+    Storage storage;                  // Policy holding the clients
 };
 
 #endif // CLIENT_HASH_H
-
@@ -13,7 +13,11 @@
 */
 
 #include "clientManager.h"
+#include "textScanner.h"
+#include <functional>
 #include <sstream>
+#include <thread>
+#include <type_traits>
 
 using namespace std;
 
@@ -33,17 +37,55 @@ ClientManager::~ClientManager() {
 
 // ----------------------------------------------------------------------------
 // insert
-// Inserts existing client object into hash table
+// Inserts existing client object into hash table, then name index, under
+// the ID's write stripe, so a remove of the same ID never runs between
+// the two; other IDs insert into the table in parallel
 // Client added if not duplicate, returns insertion success
 bool ClientManager::insert(Client* client) {
-    return hashTable.insert(client);
+    if (client == nullptr) {
+        return false;
+    }
+    // Copy the client first; the table may move it and delete the object
+    Client record = *client;
+    lock_guard<mutex> stripe(writeLocks[writeStripe(record.getID())]);
+    if (!hashTable.insert(client)) {
+        return false;
+    }
+    lock_guard<mutex> lock(indexLock);
+    nameIndex.insert(record);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// remove
+// Removes client from the hash table, then the name index, under the ID's
+// write stripe. The client is copied out inside a read section, which
+// ends before the table removes it (and may wait for readers to drain)
+// Client removed and deallocated if found, returns success status
+bool ClientManager::remove(ClientID id) {
+    lock_guard<mutex> stripe(writeLocks[writeStripe(id)]);
+    Client record;
+    {
+        ReadGuard guard(*this);
+        Client* client = nullptr;
+        if (!hashTable.retrieve(id, client)) {
+            return false;
+        }
+        record = *client;
+    }
+    if (!hashTable.remove(id)) {
+        return false;
+    }
+    lock_guard<mutex> lock(indexLock);
+    nameIndex.remove(record);
+    return true;
 }
 
 // ----------------------------------------------------------------------------
 // retrieve
 // Finds client by ID using hash table lookup
 // Client points to found Client or nullptr, returns success status
-bool ClientManager::retrieve(int id, Client*& client) const {
+bool ClientManager::retrieve(ClientID id, Client*& client) const {
     return hashTable.retrieve(id, client);
 }
 
@@ -51,7 +93,7 @@ bool ClientManager::retrieve(int id, Client*& client) const {
 // getClient
 // Alternative interface for client retrieval
 // found points to matching Client or nullptr, returns success
-bool ClientManager::getClient(int id, Client*& found) const {
+bool ClientManager::getClient(ClientID id, Client*& found) const {
     return hashTable.retrieve(id, found);
 }
 
@@ -59,7 +101,7 @@ bool ClientManager::getClient(int id, Client*& found) const {
 // addClient
 // Creates new client from parsed string data and adds to system
 // New client created and inserted, returns success status
-bool ClientManager::addClient(int id, const string& fullName) {
+bool ClientManager::addClient(ClientID id, const string& fullName) {
     string lastName, firstName;
     
     // Parse the fullName string (format: "lastName firstName")
@@ -70,8 +112,8 @@ bool ClientManager::addClient(int id, const string& fullName) {
     // Create new client object
     Client* client = new Client(id, firstName, lastName);
     
-    // Insert into hash table
-    if (hashTable.insert(client)) {
+    // Insert into hash table and name index
+    if (insert(client)) {
         return true;
     } else {
         // Insert failed (probably duplicate), clean up
@@ -92,7 +134,7 @@ int ClientManager::readClientsFromStream(istream& input) {
         if (line.empty()) continue;
         
         istringstream lineStream(line);
-        int id;
+        ClientID id;
         string lastName, firstName;
         
         // Read ID and lastName (required)
@@ -106,10 +148,11 @@ int ClientManager::readClientsFromStream(istream& input) {
         // Create new client (firstName might be empty string)
         Client* client = new Client(id, firstName, lastName);
         
-        if (hashTable.insert(client)) {
+        if (insert(client)) {
             clientsAdded++;
         } else {
-            cout << "ERROR: Failed to add client with ID " << id << " (duplicate)" << endl;
+            cout << "ERROR: Failed to add client with ID " << id << " (" << rejectReason(id)
+                 << ")" << endl;
             delete client; // Clean up if insertion failed
         }
     }
@@ -117,28 +160,175 @@ int ClientManager::readClientsFromStream(istream& input) {
     return clientsAdded;
 }
 
+// ----------------------------------------------------------------------------
+// readClientsFromBuffer
+// Same line format and handling as readClientsFromStream, scanned in place.
+// Worker threads parse chunks; inserts then run in buffer order so
+// duplicate IDs are reported and rejected exactly as a serial read would
+// All valid clients read and added, returns number successfully added
+int ClientManager::readClientsFromBuffer(string_view buffer, int threads) {
+    vector<string_view> chunks = TextScanner::splitChunks(buffer, threads);
+    vector<vector<ClientRecord>> records(chunks.size());
+
+    vector<thread> workers;
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        workers.emplace_back(parseClients, chunks[i], ref(records[i]));
+    }
+    if (!chunks.empty()) {
+        parseClients(chunks[0], records[0]);
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+
+    int clientsAdded = 0;
+    for (const vector<ClientRecord>& chunk : records) {
+        for (const ClientRecord& record : chunk) {
+            Client* client = new Client(record.id, record.firstName, record.lastName);
+            if (insert(client)) {
+                clientsAdded++;
+            } else {
+                cout << "ERROR: Failed to add client with ID " << record.id << " ("
+                     << rejectReason(record.id) << ")" << endl;
+                delete client; // Clean up if insertion failed
+            }
+        }
+    }
+
+    return clientsAdded;
+}
+
+// ----------------------------------------------------------------------------
+// parseClients
+// Scans lines "ID lastName [firstName]", skipping invalid ones
+// Valid lines appended to records in order
+void ClientManager::parseClients(string_view chunk, vector<ClientRecord>& records) {
+    while (!chunk.empty()) {
+        string_view line = TextScanner::takeLine(chunk);
+        if (line.empty()) continue;
+
+        // Read ID and lastName (required), firstName is optional
+        ClientRecord record;
+        if (!TextScanner::takeInt(line, record.id)) {
+            continue; // Skip invalid lines
+        }
+        record.lastName = TextScanner::takeWord(line);
+        if (record.lastName.empty()) {
+            continue;
+        }
+        record.firstName = TextScanner::takeWord(line);
+        records.push_back(record);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// collectAll
+// Appends all clients in hash table order
+void ClientManager::collectAll(vector<Client*>& found) const {
+    hashTable.collectAll(found);
+}
+
 // ----------------------------------------------------------------------------
 // displayAll
 // Shows all clients using hash table display method
 // All clients displayed in hash table order
-void ClientManager::displayAll() const {
-    hashTable.display();
+void ClientManager::displayAll(OutputSink& out) const {
+    hashTable.display(out);
+}
+
+// ----------------------------------------------------------------------------
+// displaySorted
+// Streams clients in name index order, looking each one up by ID inside
+// one read section, so no client is freed while it is being displayed
+// All clients displayed ordered by last name, then first name
+void ClientManager::displaySorted(OutputSink& out) const {
+    out << "CLIENTS BY NAME:\n";
+    out << "================\n";
+
+    vector<ClientID> ids;
+    {
+        lock_guard<mutex> lock(indexLock);
+        nameIndex.collectSorted(ids);
+    }
+    ReadGuard guard(*this);
+    for (ClientID id : ids) {
+        Client* client = nullptr;
+        if (hashTable.retrieve(id, client)) {
+            client->display(out);
+        }
+    }
+
+    if (ids.empty()) {
+        out << "No clients registered.\n";
+    }
+}
+
+// ----------------------------------------------------------------------------
+// findByLastNamePrefix
+// Prefix lookup in the name index, O(log n + k) for k matches. Clients
+// are copied out inside a read section, so the copies outlive removal
+// Matching clients appended to found in name order
+void ClientManager::findByLastNamePrefix(string_view prefix, vector<Client>& found) const {
+    vector<ClientID> ids;
+    {
+        lock_guard<mutex> lock(indexLock);
+        nameIndex.findByLastNamePrefix(prefix, ids);
+    }
+    ReadGuard guard(*this);
+    for (ClientID id : ids) {
+        Client* client = nullptr;
+        if (hashTable.retrieve(id, client)) {
+            found.push_back(*client);
+        }
+    }
 }
 
 // ----------------------------------------------------------------------------
 // displayStats
 // Shows hash table performance statistics
 // Hash table statistics displayed for performance analysis
-void ClientManager::displayStats() const {
-    hashTable.displayStats();
+void ClientManager::displayStats(OutputSink& out) const {
+    hashTable.displayStats(out);
 }
 
 // ----------------------------------------------------------------------------
 // clear
 // Removes all clients from the management system
-// All clients removed and deallocated via hash table clear
+// All clients removed and deallocated via hash table clear, index emptied;
+// every write stripe is held, so no insert or remove is half done
 void ClientManager::clear() {
+    vector<unique_lock<mutex>> stripes;
+    for (mutex& stripe : writeLocks) {
+        stripes.emplace_back(stripe);
+    }
+    lock_guard<mutex> lock(indexLock);
     hashTable.clear();
+    nameIndex.clear();
+}
+
+// ----------------------------------------------------------------------------
+// holdsID
+// Only the direct table limits IDs; every other table holds any ID
+bool ClientManager::holdsID(ClientID id) {
+    if constexpr (is_same<ClientTable, ClientHash<DirectClientStorage>>::value) {
+        return id >= DirectClientStorage::DIRECT_MIN_ID &&
+               id <= DirectClientStorage::DIRECT_MAX_ID;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// rejectReason
+// Why an insert of a non-null client with id failed
+const char* ClientManager::rejectReason(ClientID id) {
+    return holdsID(id) ? "duplicate" : "ID outside the client table's range";
+}
+
+// ----------------------------------------------------------------------------
+// writeStripe
+// Write lock stripe of an ID; the same ID always maps to the same stripe
+size_t ClientManager::writeStripe(ClientID id) {
+    return hash<ClientID>()(id) % WRITE_STRIPES;
 }
 
 // ----------------------------------------------------------------------------
@@ -7,7 +7,7 @@
               Uses hash table for O(1) average lookup time.
  Author: Sharjeel Khan
  Assumptions: Client data format is "ID lastName firstName" with spaces
-              Client IDs are unique 4-digit integers
+              Client IDs are unique positive 64-bit integers
               Hash table provides O(1) average lookup time
               Some clients may have only lastName (no firstName)
 -----------------------------------------------------------------------------
@@ -18,45 +18,129 @@
 
 #include "client.h"
 #include "clientHash.h"
+#include "clientNameIndex.h"
 #include <string>
+#include <string_view>
 #include <iostream>
+#include <mutex>
+#include <vector>
 
 using namespace std;
 
+// Table holding the clients, picked at build time: open addressing by
+// default, separate chaining with SSSS_CHAINED_CLIENT_HASH, one slot per
+// 4-digit ID with SSSS_DIRECT_CLIENT_HASH, lock-free lookups alongside
+// concurrent inserts and removes with SSSS_CONCURRENT_CLIENT_HASH, or the
+// smallest footprint with SSSS_COMPACT_CLIENT_HASH. The direct table only
+// holds IDs 1000-9999; clients with other IDs are rejected and reported
+// as out of range (see holdsID)
+#if defined(SSSS_COMPACT_CLIENT_HASH)
+using ClientTable = ClientHash<CompactClientStorage>;
+#elif defined(SSSS_CONCURRENT_CLIENT_HASH)
+using ClientTable = ClientHash<ConcurrentClientStorage>;
+#elif defined(SSSS_DIRECT_CLIENT_HASH)
+using ClientTable = ClientHash<DirectClientStorage>;
+#elif defined(SSSS_CHAINED_CLIENT_HASH)
+using ClientTable = ClientHash<ChainedClientStorage>;
+#else
+using ClientTable = ClientHash<FlatClientStorage>;
+#endif
+
 class ClientManager {
 public:
+    // Keeps clients from retrieve/getClient valid while in scope; with the
+    // concurrent table another thread may remove them meanwhile
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const ClientManager& manager) : guard(manager.hashTable) {}
+
+    private:
+        ClientTable::ReadGuard guard;
+    };
+
     // Default Constructor
     ClientManager();
     
     // Destructor
     ~ClientManager();
 
-    // Inserts existing client object into management system
+    // Inserts existing client object into management system; on success
+    // the manager owns it (the table may move it and delete the object).
+    // With the concurrent table, insert, remove and clear may run on
+    // several threads, but not while the calling thread holds a ReadGuard.
+    // Changes to one ID are serialized and update the table, then the
+    // name index; changes to different IDs only share the index update
     bool insert(Client* client);
+
+    // Removes and deallocates client with specified ID
+    bool remove(ClientID id);
     
-    // Finds client by ID in the management system
-    bool retrieve(int id, Client*& client) const;
+    // Finds client by ID in the management system; with the concurrent
+    // table this (and getClient) may run alongside insert and remove
+    bool retrieve(ClientID id, Client*& client) const;
 
     // Alternative interface for client retrieval (same as retrieve)
-    bool getClient(int id, Client*& found) const;
+    bool getClient(ClientID id, Client*& found) const;
     
     // Creates and adds new client from string data
-    bool addClient(int id, const string& fullName);
+    bool addClient(ClientID id, const string& fullName);
     
     // Reads multiple clients from input stream (for file processing)
     int readClientsFromStream(istream& input);
 
-    // Shows all clients in the management system
-    void displayAll() const;
+    // Reads multiple clients from an in-memory buffer (e.g. a mapped file),
+    // slicing fields in place instead of going through a stream. Chunks of
+    // the buffer are parsed on up to threads threads, then inserted in order
+    int readClientsFromBuffer(string_view buffer, int threads = 1);
+
+    // Appends every client to found in display order
+    void collectAll(vector<Client*>& found) const;
+
+    // Appends all clients in the management system to out
+    void displayAll(OutputSink& out) const;
+
+    // Appends all clients to out ordered by last name, then first name
+    void displaySorted(OutputSink& out) const;
 
-    // Shows hash table performance statistics
-    void displayStats() const;
+    // Appends copies of clients whose last name starts with prefix to
+    // found, in (lastName, firstName) order; copies need no ReadGuard
+    void findByLastNamePrefix(string_view prefix, vector<Client>& found) const;
+
+    // Appends hash table performance statistics to out
+    void displayStats(OutputSink& out) const;
     
     // Removes all clients from management system
     void clear();
 
+    // Returns true if the client table selected at build time can hold id
+    // (false only outside 1000-9999 with SSSS_DIRECT_CLIENT_HASH)
+    static bool holdsID(ClientID id);
+
 private:
-    ClientHash hashTable;         // Custom hash table for O(1) client lookup
+    // One valid client line, fields viewing the scanned buffer
+    struct ClientRecord {
+        ClientID id;                  // Client ID
+        string_view lastName;         // Last name (required)
+        string_view firstName;        // First name (may be empty)
+    };
+
+    static const size_t WRITE_STRIPES = 64;     // Per-ID writer locks
+
+    ClientTable hashTable;        // Custom hash table for O(1) client lookup
+    ClientNameIndex nameIndex;    // Clients ordered by name, kept in step
+                                  // with every insert and remove
+    mutex writeLocks[WRITE_STRIPES];  // An insert or remove holds its ID's
+                                      // stripe across table and index
+    mutable mutex indexLock;      // Guards nameIndex updates and queries
+
+    // Returns index of the write lock stripe for id
+    static size_t writeStripe(ClientID id);
+
+    // Returns reason an insert of a client with id failed, for messages
+    static const char* rejectReason(ClientID id);
+
+    // Parses valid client lines of chunk into records (no shared state)
+    static void parseClients(string_view chunk, vector<ClientRecord>& records);
 
    
   
@@ -0,0 +1,135 @@
+/*
+-----------------------------------------------------------------------------
+ File: clientNameIndex.cpp
+ Description: Implementation of ClientNameIndex. Prefix matches are
+              contiguous in the sorted array: they start at the first last
+              name not less than the prefix and end at the first that does
+              not start with it.
+ Author: Sharjeel Khan
+ Assumptions: Names compare bytewise, as std::string does
+              Equal handles are equal names, so comparisons only resolve
+              handles that differ
+ -----------------------------------------------------------------------------
+*/
+
+#include "clientNameIndex.h"
+#include <algorithm>
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+// Constructor
+// Initializes empty index
+ClientNameIndex::ClientNameIndex() : sortedCount(0) {
+}
+
+// ----------------------------------------------------------------------------
+// entryLess
+// Returns true if a sorts before b by lastName, firstName, then ID
+bool ClientNameIndex::entryLess(const Entry& a, const Entry& b) {
+    const ClientNamePool& names = ClientNamePool::getDefault();
+    int order = a.lastName == b.lastName ? 0 : names.view(a.lastName).compare(names.view(b.lastName));
+    if (order == 0 && a.firstName != b.firstName) {
+        order = names.view(a.firstName).compare(names.view(b.firstName));
+    }
+    return order != 0 ? order < 0 : a.id < b.id;
+}
+
+// ----------------------------------------------------------------------------
+// insert
+// Appends to the pending tail; an entry that sorts after the whole sorted
+// prefix joins it directly, which keeps in-order loads free of merges
+void ClientNameIndex::insert(const Client& client) {
+    entries.push_back(Entry{client.getLastNameHandle(), client.getFirstNameHandle(), client.getID()});
+    if (sortedCount + 1 == entries.size() &&
+        (sortedCount == 0 || !entryLess(entries.back(), entries[sortedCount - 1]))) {
+        sortedCount++;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// remove
+// Binary searches the sorted prefix, then scans the pending tail
+// Entry removed if found, returns whether it was
+bool ClientNameIndex::remove(const Client& client) {
+    ClientID id = client.getID();
+    Entry key{client.getLastNameHandle(), client.getFirstNameHandle(), id};
+    auto sortedEnd = entries.begin() + sortedCount;
+    auto found = lower_bound(entries.begin(), sortedEnd, key, entryLess);
+    if (found != sortedEnd && found->id == id) {
+        entries.erase(found);
+        sortedCount--;
+        return true;
+    }
+
+    for (auto pending = sortedEnd; pending != entries.end(); ++pending) {
+        if (pending->id == id) {
+            if (pending + 1 != entries.end()) {
+                *pending = entries.back();         // Tail order doesn't matter
+            }
+            entries.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// mergePending
+// Sorts the pending tail and merges it into the sorted prefix
+// Whole array sorted
+void ClientNameIndex::mergePending() const {
+    if (sortedCount == entries.size()) {
+        return;
+    }
+    auto sortedEnd = entries.begin() + sortedCount;
+    sort(sortedEnd, entries.end(), entryLess);
+    inplace_merge(entries.begin(), sortedEnd, entries.end(), entryLess);
+    sortedCount = entries.size();
+}
+
+// ----------------------------------------------------------------------------
+// collectSorted
+// Appends every ID to ids in index order
+void ClientNameIndex::collectSorted(vector<ClientID>& ids) const {
+    mergePending();
+    ids.reserve(ids.size() + entries.size());
+    for (const Entry& entry : entries) {
+        ids.push_back(entry.id);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// findByLastNamePrefix
+// Binary search to the first last name not less than prefix, then scan
+// while last names still start with it
+// Matching IDs appended to ids in index order
+void ClientNameIndex::findByLastNamePrefix(string_view prefix, vector<ClientID>& ids) const {
+    mergePending();
+    const ClientNamePool& names = ClientNamePool::getDefault();
+    auto first = lower_bound(entries.begin(), entries.end(), prefix,
+                             [&names](const Entry& entry, string_view key) {
+                                 return names.view(entry.lastName) < key;
+                             });
+    for (auto current = first; current != entries.end(); ++current) {
+        if (names.view(current->lastName).substr(0, prefix.size()) != prefix) {
+            break;
+        }
+        ids.push_back(current->id);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// size
+// Returns number of entries
+size_t ClientNameIndex::size() const {
+    return entries.size();
+}
+
+// ----------------------------------------------------------------------------
+// clear
+// Removes all entries
+void ClientNameIndex::clear() {
+    entries.clear();
+    sortedCount = 0;
+}
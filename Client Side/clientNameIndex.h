@@ -0,0 +1,70 @@
+/*
+ -----------------------------------------------------------------------------
+ File: clientNameIndex.h
+ Description: Secondary index of clients ordered by (lastName, firstName),
+              with ID as the tie-breaker. Entries are kept in one sorted
+              array, so a sorted listing is a sequential scan and a last
+              name prefix lookup is a binary search followed by a scan of
+              the k matches, O(log n + k). Inserts are appended to an
+              unsorted tail that is sorted and merged in on the next query,
+              so loading many clients costs one sort rather than one array
+              shift per client. Entries hold name pool handles, 16 bytes
+              each, and compare through the pool.
+ Author: Sharjeel Khan
+ Assumptions: Caller keeps the index in step with the client table
+              Queries are not run concurrently with each other or with
+              updates, since a query may merge the pending tail
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef CLIENT_NAME_INDEX_H
+#define CLIENT_NAME_INDEX_H
+
+#include "client.h"
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+class ClientNameIndex {
+public:
+    // Creates empty index
+    ClientNameIndex();
+
+    // Adds entry for client's ID and names
+    void insert(const Client& client);
+
+    // Removes the entry for client's ID and names, returns false if absent
+    bool remove(const Client& client);
+
+    // Appends every ID to ids in (lastName, firstName, ID) order
+    void collectSorted(vector<ClientID>& ids) const;
+
+    // Appends, in index order, IDs of clients whose last name starts
+    // with prefix (every client for an empty prefix)
+    void findByLastNamePrefix(string_view prefix, vector<ClientID>& ids) const;
+
+    // Returns number of entries
+    size_t size() const;
+
+    // Removes all entries
+    void clear();
+
+private:
+    struct Entry {
+        ClientNamePool::Handle lastName;
+        ClientNamePool::Handle firstName;
+        ClientID id;
+    };
+
+    mutable vector<Entry> entries;    // Sorted prefix, then unsorted tail
+    mutable size_t sortedCount;       // Entries in the sorted prefix
+
+    // Orders entries by lastName, firstName, then ID
+    static bool entryLess(const Entry& a, const Entry& b);
+
+    // Sorts the tail and merges it into the sorted prefix
+    void mergePending() const;
+};
+
+#endif // CLIENT_NAME_INDEX_H
@@ -0,0 +1,142 @@
+/*
+-----------------------------------------------------------------------------
+ File: clientNamePool.cpp
+ Description: Implementation of ClientNamePool. A new name is copied into
+              the arena and its view written to the next block entry
+              before the handle is returned, so any thread that later sees
+              the handle also sees the entry. Blocks are allocated as
+              handles reach them and never move; the block table is
+              allocated whole and zeroed lazily by calloc.
+ Author: Sharjeel Khan
+ Assumptions: Names hash the same way as StringPool strings
+ -----------------------------------------------------------------------------
+*/
+
+#include "clientNamePool.h"
+#include "mediaHash.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+// Constructor
+// Creates the first block, holding the empty name at handle EMPTY_NAME
+ClientNamePool::ClientNamePool()
+    : storage(STORAGE_SLAB_SIZE), capacity(INITIAL_CAPACITY), count(1), bytesStored(0) {
+    blocks = static_cast<string_view**>(calloc(MAX_BLOCKS, sizeof(string_view*)));
+    if (blocks == nullptr) {
+        throw bad_alloc();
+    }
+    blocks[0] = new string_view[BLOCK_SIZE];
+    slots = new Slot[capacity]();
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Frees blocks and lookup table; the arena frees the characters
+ClientNamePool::~ClientNamePool() {
+    for (size_t i = 0; i < MAX_BLOCKS && blocks[i] != nullptr; ++i) {
+        delete[] blocks[i];
+    }
+    free(blocks);
+    delete[] slots;
+}
+
+// ----------------------------------------------------------------------------
+// getDefault
+// Returns pool shared by every Client
+ClientNamePool& ClientNamePool::getDefault() {
+    static ClientNamePool defaultPool;
+    return defaultPool;
+}
+
+// ----------------------------------------------------------------------------
+// intern
+// Probes the lookup table for name; an absent name is copied into storage
+// and issued the next handle
+// Returns handle resolving to name (EMPTY_NAME for empty name)
+ClientNamePool::Handle ClientNamePool::intern(string_view name) {
+    if (name.empty()) {
+        return EMPTY_NAME;
+    }
+    uint32_t hash = (uint32_t)MediaHash::hashString(name);
+
+    lock_guard<mutex> lock(interning);
+    size_t mask = capacity - 1;
+    size_t i = hash & mask;
+    for (; slots[i].handle != EMPTY_NAME; i = (i + 1) & mask) {
+        if (slots[i].hash == hash && view(slots[i].handle) == name) {
+            return slots[i].handle;
+        }
+    }
+
+    // New name - copy it in and publish its entry before the handle
+    Handle handle = (Handle)count;
+    string_view*& block = blocks[handle >> BLOCK_SHIFT];
+    if (block == nullptr) {
+        block = new string_view[BLOCK_SIZE];
+    }
+    char* stored = static_cast<char*>(storage.allocate(name.size(), 1));
+    memcpy(stored, name.data(), name.size());
+    block[handle & (BLOCK_SIZE - 1)] = string_view(stored, name.size());
+    bytesStored += name.size();
+    count++;
+
+    slots[i].hash = hash;
+    slots[i].handle = handle;
+    if (count * 2 > capacity) {
+        grow();
+    }
+    return handle;
+}
+
+// ----------------------------------------------------------------------------
+// getUniqueCount
+// Returns number of distinct non-empty names
+size_t ClientNamePool::getUniqueCount() const {
+    lock_guard<mutex> lock(interning);
+    return count - 1;
+}
+
+// ----------------------------------------------------------------------------
+// getBytesStored
+// Returns bytes copied into pool storage
+size_t ClientNamePool::getBytesStored() const {
+    lock_guard<mutex> lock(interning);
+    return bytesStored;
+}
+
+// ----------------------------------------------------------------------------
+// displayStats
+// Shows pool size and memory figures for analysis
+void ClientNamePool::displayStats(OutputSink& out) const {
+    lock_guard<mutex> lock(interning);
+    out << "Client Name Pool Statistics:\n";
+    out << "Distinct names: " << count - 1 << '\n';
+    out << "Bytes stored: " << bytesStored << '\n';
+    out << "Handle blocks: " << (count + BLOCK_SIZE - 1) / BLOCK_SIZE << '\n';
+}
+
+// ----------------------------------------------------------------------------
+// grow
+// Doubles table capacity and reinserts entries using their cached hashes
+void ClientNamePool::grow() {
+    Slot* oldSlots = slots;
+    size_t oldCapacity = capacity;
+
+    capacity *= 2;
+    slots = new Slot[capacity]();
+    size_t mask = capacity - 1;
+    for (size_t j = 0; j < oldCapacity; ++j) {
+        if (oldSlots[j].handle != EMPTY_NAME) {
+            size_t i = oldSlots[j].hash & mask;
+            while (slots[i].handle != EMPTY_NAME) {
+                i = (i + 1) & mask;
+            }
+            slots[i] = oldSlots[j];
+        }
+    }
+    delete[] oldSlots;
+}
@@ -0,0 +1,90 @@
+/*
+ -----------------------------------------------------------------------------
+ File: clientNamePool.h
+ Description: Interning pool for client names. Each distinct first or last
+              name is copied once into arena slabs and given a 32-bit
+              handle, so a Client stores two handles instead of two
+              strings, and the thousands of patrons named Smith share one
+              copy. A handle resolves to a string_view through a two-level
+              block table that never moves, so resolving takes no lock and
+              stays valid while other threads intern new names.
+ Author: Sharjeel Khan
+ Assumptions: Names are never freed; they live as long as the pool
+              Fewer than 2^32 distinct names are interned
+              A handle is only resolved by a thread that got it through a
+              synchronized path (same thread, or a published Client)
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef CLIENT_NAME_POOL_H
+#define CLIENT_NAME_POOL_H
+
+#include "arena.h"
+#include "outputSink.h"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+
+using namespace std;
+
+class ClientNamePool {
+public:
+    using Handle = uint32_t;
+    static const Handle EMPTY_NAME = 0;           // Handle of the empty name
+
+    // Creates pool holding only the empty name
+    ClientNamePool();
+
+    // Frees the block and lookup tables; names are freed with the arena
+    ~ClientNamePool();
+
+    // Returns handle of name, copying name in on first sight; thread-safe
+    Handle intern(string_view name);
+
+    // Returns the name a handle was interned from; no locking
+    string_view view(Handle handle) const {
+        return blocks[handle >> BLOCK_SHIFT][handle & (BLOCK_SIZE - 1)];
+    }
+
+    // Number of distinct names and the bytes they occupy
+    size_t getUniqueCount() const;
+    size_t getBytesStored() const;
+
+    // Appends pool usage statistics to out
+    void displayStats(OutputSink& out) const;
+
+    // Process-wide pool holding the names of every Client
+    static ClientNamePool& getDefault();
+
+private:
+    static const size_t BLOCK_SHIFT = 12;                 // 4096 names/block
+    static const size_t BLOCK_SIZE = (size_t)1 << BLOCK_SHIFT;
+    static const size_t MAX_BLOCKS = (size_t)1 << (32 - BLOCK_SHIFT);
+    static const size_t INITIAL_CAPACITY = 1024;          // Power of two
+    static const size_t STORAGE_SLAB_SIZE = 64 * 1024;
+
+    // Lookup table entry; handle EMPTY_NAME marks a free slot
+    struct Slot {
+        uint32_t hash;                // Low bits of the name's hash
+        Handle handle;                // Interned name
+    };
+
+    Arena storage;                    // Character data of interned names
+    string_view** blocks;             // Handle -> name, blocks of BLOCK_SIZE
+    Slot* slots;                      // Open-addressed name -> handle table
+    size_t capacity;                  // Number of slots (power of two)
+    size_t count;                     // Handles issued, the empty name too
+    size_t bytesStored;               // Bytes copied into storage
+    mutable mutex interning;          // Guards everything but reads of
+                                      // published blocks
+
+    // Doubles the lookup table and reinserts every entry
+    void grow();
+
+    // Pool hands out views into its own storage, copying is not supported
+    ClientNamePool(const ClientNamePool&) = delete;
+    ClientNamePool& operator=(const ClientNamePool&) = delete;
+};
+
+#endif // CLIENT_NAME_POOL_H
@@ -0,0 +1,279 @@
+/*
+-----------------------------------------------------------------------------
+ File: compactClientStorage.cpp
+ Description: Implementation of CompactClientStorage. Probing is linear,
+              so a run of full slots is contiguous memory; removal moves
+              later clients of the run back into the hole when their home
+              slot allows it, which keeps every run unbroken.
+ Author: Sharjeel Khan
+ Assumptions: Table is kept at most 3/4 full, so every probe reaches an
+              empty slot and runs stay short
+ -----------------------------------------------------------------------------
+*/
+
+#include "compactClientStorage.h"
+#include <limits>
+#include <memory>
+#include <new>
+
+using namespace std;
+
+// Constants
+const uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ull;  // 2^64 / golden ratio
+const ClientID EMPTY_ID = numeric_limits<ClientID>::min();
+const size_t MAX_LOAD_NUMERATOR = 3;  // Grow past 3/4 full
+const size_t MAX_LOAD_DENOMINATOR = 4;
+
+// ----------------------------------------------------------------------------
+// Default Constructor
+// Initializes empty table; the array is allocated on first insert
+CompactClientStorage::CompactClientStorage()
+    : records(nullptr), capacity(0), count(0) {
+    static_assert(CACHE_LINE % sizeof(Client) == 0,
+                  "clients must not straddle cache lines");
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Cleans up all hash table resources
+CompactClientStorage::~CompactClientStorage() {
+    release();
+}
+
+// ----------------------------------------------------------------------------
+// hashFunction
+// Fibonacci hashing, high half folded into the low bits used for the slot
+uint64_t CompactClientStorage::hashFunction(ClientID id) {
+    uint64_t hash = (uint64_t)id * HASH_MULTIPLIER;
+    return hash ^ (hash >> 32);
+}
+
+// ----------------------------------------------------------------------------
+// homeSlot
+// Returns slot where id's probe run starts
+size_t CompactClientStorage::homeSlot(ClientID id) const {
+    return hashFunction(id) & (capacity - 1);
+}
+
+// ----------------------------------------------------------------------------
+// findSlot
+// Scans from the home slot to the first empty slot
+// Returns slot holding id, or capacity if absent
+size_t CompactClientStorage::findSlot(ClientID id) const {
+    if (capacity == 0) {
+        return capacity;
+    }
+    size_t mask = capacity - 1;
+    for (size_t slot = homeSlot(id); ; slot = (slot + 1) & mask) {
+        ClientID stored = records[slot].getID();
+        if (stored == id) {
+            return slot;
+        }
+        if (stored == EMPTY_ID) {
+            return capacity;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// insert
+// Grows first if the new client would pass the load limit, then copies
+// the client into the first empty slot of its run
+// Client inserted and passed object deleted if not duplicate
+bool CompactClientStorage::insert(Client* client) {
+    if (client == nullptr || client->getID() == EMPTY_ID) {
+        return false;
+    }
+    ClientID id = client->getID();
+    if (findSlot(id) != capacity) {
+        return false; // Duplicate ID found, don't insert
+    }
+
+    if ((count + 1) * MAX_LOAD_DENOMINATOR > capacity * MAX_LOAD_NUMERATOR) {
+        size_t newCapacity = capacity == 0 ? MIN_CAPACITY : capacity * 2;
+        if (capacity > 0) {
+            resizes.push_back(Resize{capacity, newCapacity, count});
+        }
+        rehash(newCapacity);
+    }
+
+    size_t mask = capacity - 1;
+    size_t slot = homeSlot(id);
+    while (records[slot].getID() != EMPTY_ID) {
+        slot = (slot + 1) & mask;
+    }
+    records[slot] = *client;
+    count++;
+
+    delete client;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// retrieve
+// Searches for client by ID in hash table
+// found points to matching Client or nullptr, returns success status
+bool CompactClientStorage::retrieve(ClientID id, Client*& found) const {
+    size_t slot = findSlot(id);
+    if (slot == capacity) {
+        found = nullptr;
+        return false;
+    }
+    found = &records[slot];
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// remove
+// Backward-shift deletion: each later client of the run whose home slot
+// is not between the hole and itself moves into the hole
+// Client removed if found, returns success status
+bool CompactClientStorage::remove(ClientID id) {
+    size_t hole = findSlot(id);
+    if (hole == capacity) {
+        return false; // Client not found
+    }
+
+    size_t mask = capacity - 1;
+    for (size_t slot = (hole + 1) & mask; records[slot].getID() != EMPTY_ID;
+         slot = (slot + 1) & mask) {
+        size_t home = homeSlot(records[slot].getID());
+        // Client can move only if its home is at or before the hole,
+        // measured cyclically from the client's own slot
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            records[hole] = records[slot];
+            hole = slot;
+        }
+    }
+    records[hole].setData(EMPTY_ID, string_view(), string_view());
+    count--;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// collectAll
+// Walks slots in order
+// All clients appended to found in the same order display shows them
+void CompactClientStorage::collectAll(vector<Client*>& found) const {
+    for (size_t i = 0; i < capacity; ++i) {
+        if (records[i].getID() != EMPTY_ID) {
+            found.push_back(&records[i]);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// display
+// Displays all clients in slot order
+// All clients displayed with their information
+void CompactClientStorage::display(OutputSink& out) const {
+    for (size_t i = 0; i < capacity; ++i) {
+        if (records[i].getID() != EMPTY_ID) {
+            records[i].display(out);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// size
+// Returns number of full slots
+size_t CompactClientStorage::size() const {
+    return count;
+}
+
+// ----------------------------------------------------------------------------
+// displayStats
+// Probe length is the number of slots a lookup of each client reads
+// Slot usage, probe and memory statistics displayed
+void CompactClientStorage::displayStats(OutputSink& out) const {
+    size_t totalProbes = 0;
+    size_t maxProbes = 0;
+    size_t mask = capacity - 1;
+
+    for (size_t i = 0; i < capacity; ++i) {
+        if (records[i].getID() == EMPTY_ID) {
+            continue;
+        }
+        size_t probes = ((i - homeSlot(records[i].getID())) & mask) + 1;
+        totalProbes += probes;
+        if (probes > maxProbes) {
+            maxProbes = probes;
+        }
+    }
+
+    out << "Compact Hash Table Statistics:\n";
+    out << "Total slots: " << capacity << '\n';
+    out << "Total clients: " << count << '\n';
+    out << "Slot size (bytes): " << sizeof(Client) << '\n';
+    out << "Max probe length (slots): " << maxProbes << '\n';
+    if (count > 0) {
+        out << "Average probe length (slots): " << (double)totalProbes / count << '\n';
+        out << "Load factor: " << (double)count / capacity << '\n';
+        out << "Table bytes per client: " << (double)(capacity * sizeof(Client)) / count << '\n';
+    }
+    out << "Resizes: " << resizes.size() << '\n';
+    for (const Resize& resize : resizes) {
+        out << "  " << resize.fromSlots << " -> " << resize.toSlots
+            << " slots at " << resize.clients << " clients\n";
+    }
+    ClientNamePool::getDefault().displayStats(out);
+}
+
+// ----------------------------------------------------------------------------
+// clear
+// Removes all elements from hash table
+// All clients deallocated, table reset to empty
+void CompactClientStorage::clear() {
+    release();
+}
+
+// ----------------------------------------------------------------------------
+// rehash
+// Copies every client into a fresh array; no ID can be a duplicate, so
+// each goes to the first empty slot of its run
+// Table has newCapacity slots
+void CompactClientStorage::rehash(size_t newCapacity) {
+    Client* oldRecords = records;
+    size_t oldCapacity = capacity;
+
+    records = allocateSlots(newCapacity);
+    capacity = newCapacity;
+    size_t mask = capacity - 1;
+    for (size_t i = 0; i < oldCapacity; ++i) {
+        ClientID id = oldRecords[i].getID();
+        if (id != EMPTY_ID) {
+            size_t slot = homeSlot(id);
+            while (records[slot].getID() != EMPTY_ID) {
+                slot = (slot + 1) & mask;
+            }
+            records[slot] = oldRecords[i];
+        }
+    }
+
+    destroy_n(oldRecords, oldCapacity);
+    ::operator delete(oldRecords, align_val_t(CACHE_LINE));
+}
+
+// ----------------------------------------------------------------------------
+// allocateSlots
+// Aligned so every group of four slots is exactly one cache line
+// Returns array of count clients with EMPTY_ID
+Client* CompactClientStorage::allocateSlots(size_t count) {
+    Client* slots = static_cast<Client*>(
+        ::operator new(count * sizeof(Client), align_val_t(CACHE_LINE)));
+    uninitialized_fill_n(slots, count, Client(EMPTY_ID, string_view(), string_view()));
+    return slots;
+}
+
+// ----------------------------------------------------------------------------
+// release
+// Frees the slot array and resets to the unallocated state
+void CompactClientStorage::release() {
+    if (records != nullptr) {
+        destroy_n(records, capacity);
+        ::operator delete(records, align_val_t(CACHE_LINE));
+    }
+    records = nullptr;
+    capacity = 0;
+    count = 0;
+}
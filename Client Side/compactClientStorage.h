@@ -0,0 +1,104 @@
+/*
+ -----------------------------------------------------------------------------
+ File: compactClientStorage.h
+ Description: Smallest-footprint storage policy for ClientHash. Clients
+              (an ID and two name pool handles, 16 bytes) are stored in one
+              cache-line aligned array and probed linearly by ID, with no
+              control bytes, nodes or per-client allocation. Four clients
+              share a cache line, so a lookup normally reads only the line
+              of its home slot. Removal shifts the rest of the probe run
+              back instead of leaving tombstones.
+ Author: Sharjeel Khan
+ Assumptions: Client pointers returned by retrieve stay valid until the
+              next insert or remove, either of which may move clients
+              The smallest ClientID value is reserved to mark empty slots
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef COMPACT_CLIENT_STORAGE_H
+#define COMPACT_CLIENT_STORAGE_H
+
+#include "client.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class CompactClientStorage {
+public:
+    // Single-threaded storage, reads need no protection
+    struct ReadGuard {
+        explicit ReadGuard(const CompactClientStorage&) {}
+    };
+
+    // Default Constructor
+    CompactClientStorage();
+
+    // Destructor
+    ~CompactClientStorage();
+
+    // Copies client into the table using ID as key; on success the table
+    // owns the client and deletes the passed object
+    bool insert(Client* client);
+
+    // Finds client by ID in hash table
+    bool retrieve(ClientID id, Client*& found) const;
+
+    // Removes client with specified ID from hash table
+    bool remove(ClientID id);
+
+    // Appends every client to found in slot order
+    void collectAll(vector<Client*>& found) const;
+
+    // Appends all clients to out in slot order (no heading)
+    void display(OutputSink& out) const;
+
+    // Returns number of clients stored
+    size_t size() const;
+
+    // Appends slot, probe and memory statistics, including every resize,
+    // to out for debugging/analysis
+    void displayStats(OutputSink& out) const;
+
+    // Removes all elements from hash table
+    void clear();
+
+private:
+    static const size_t MIN_CAPACITY = 16;      // Smallest allocated table
+    static const size_t CACHE_LINE = 64;
+
+    // One growth of the slot array
+    struct Resize {
+        size_t fromSlots;             // Slots before
+        size_t toSlots;               // Slots after
+        size_t clients;               // Clients when it happened
+    };
+
+    Client* records;                  // Slot array, EMPTY_ID where free
+    size_t capacity;                  // Slots, a power of two (0 if unused)
+    size_t count;                     // Full slots
+    vector<Resize> resizes;           // Growth history, oldest first
+
+    // Mixes id so consecutive IDs spread over the table
+    static uint64_t hashFunction(ClientID id);
+
+    // Returns slot where id's probe run starts
+    size_t homeSlot(ClientID id) const;
+
+    // Returns slot holding id, or capacity if absent
+    size_t findSlot(ClientID id) const;
+
+    // Reallocates with newCapacity slots and reinserts every client
+    void rehash(size_t newCapacity);
+
+    // Allocates count empty slots on a cache line boundary
+    static Client* allocateSlots(size_t count);
+
+    // Frees the slot array
+    void release();
+
+    // Tables own their clients, copying is not supported
+    CompactClientStorage(const CompactClientStorage&) = delete;
+    CompactClientStorage& operator=(const CompactClientStorage&) = delete;
+};
+
+#endif // COMPACT_CLIENT_STORAGE_H
@@ -0,0 +1,378 @@
+/*
+-----------------------------------------------------------------------------
+ File: concurrentClientStorage.cpp
+ Description: Implementation of ConcurrentClientStorage. A writer only
+              changes one link (or one bucket head) per operation, with a
+              release store after the node is fully built, so a reader
+              walking a chain sees either the old or the new chain, never
+              a partial one. An unlinked node keeps its next pointer, so a
+              reader standing on it can finish its walk.
+ Author: Sharjeel Khan
+ Assumptions: Growth holds every stripe lock, so a writer holding one
+              stripe sees a table that cannot change under it
+ -----------------------------------------------------------------------------
+*/
+
+#include "concurrentClientStorage.h"
+
+using namespace std;
+
+// Constants
+const uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ull;  // 2^64 / golden ratio
+
+// ----------------------------------------------------------------------------
+// Table Constructor
+// Allocates size empty buckets
+ConcurrentClientStorage::Table::Table(size_t size)
+    : size(size), buckets(new atomic<Node*>[size]) {
+    for (size_t i = 0; i < size; ++i) {
+        buckets[i].store(nullptr, memory_order_relaxed);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Table Destructor
+// Deletes every node still linked; clients belong to the storage
+ConcurrentClientStorage::Table::~Table() {
+    for (size_t i = 0; i < size; ++i) {
+        Node* node = buckets[i].load(memory_order_relaxed);
+        while (node != nullptr) {
+            Node* next = node->next.load(memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+    delete[] buckets;
+}
+
+// ----------------------------------------------------------------------------
+// Default Constructor
+// Initializes empty storage with MIN_BUCKETS buckets
+ConcurrentClientStorage::ConcurrentClientStorage()
+    : table(new Table(MIN_BUCKETS)), count(0), reclaimed(0) {
+    static_assert(MIN_BUCKETS >= STRIPE_COUNT && (MIN_BUCKETS & (MIN_BUCKETS - 1)) == 0,
+                  "bucket count must be a power of two covering every stripe");
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// No readers remain, so everything is freed directly
+ConcurrentClientStorage::~ConcurrentClientStorage() {
+    Table* current = table.load(memory_order_relaxed);
+    for (size_t i = 0; i < current->size; ++i) {
+        for (Node* node = current->buckets[i].load(memory_order_relaxed); node != nullptr;
+             node = node->next.load(memory_order_relaxed)) {
+            delete node->client;
+        }
+    }
+    delete current;
+
+    for (Node* node : retiredNodes) {
+        delete node;
+    }
+    for (Client* client : retiredClients) {
+        delete client;
+    }
+    for (Table* retired : retiredTables) {
+        delete retired;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// hashFunction
+// Fibonacci hashing, high half folded into the low bits used for bucket
+// and stripe
+uint64_t ConcurrentClientStorage::hashFunction(ClientID id) {
+    uint64_t hash = (uint64_t)id * HASH_MULTIPLIER;
+    return hash ^ (hash >> 32);
+}
+
+// ----------------------------------------------------------------------------
+// stripeFor
+// Bucket counts are multiples of STRIPE_COUNT, so a bucket keeps its
+// stripe when the table grows
+ConcurrentClientStorage::Stripe& ConcurrentClientStorage::stripeFor(uint64_t hash) {
+    return stripes[hash & (STRIPE_COUNT - 1)];
+}
+
+// ----------------------------------------------------------------------------
+// insert
+// Checks the chain for a duplicate, then publishes a new head
+// Client inserted if not duplicate, table may grow
+bool ConcurrentClientStorage::insert(Client* client) {
+    if (client == nullptr) {
+        return false;
+    }
+    ClientID id = client->getID();
+    uint64_t hash = hashFunction(id);
+    {
+        lock_guard<mutex> lock(stripeFor(hash).lock);
+        Table* current = table.load(memory_order_acquire);
+        atomic<Node*>& head = current->buckets[hash & (current->size - 1)];
+        Node* first = head.load(memory_order_relaxed);
+        for (Node* node = first; node != nullptr; node = node->next.load(memory_order_relaxed)) {
+            if (node->id == id) {
+                return false; // Duplicate ID found, don't insert
+            }
+        }
+        head.store(new Node(id, client, first), memory_order_release);
+        count.fetch_add(1, memory_order_relaxed);
+    }
+
+    growIfNeeded();
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// retrieve
+// Lock-free walk of id's chain inside a read section
+// found points to matching Client or nullptr, returns success status
+bool ConcurrentClientStorage::retrieve(ClientID id, Client*& found) const {
+    ReadGuard guard(*this);
+    uint64_t hash = hashFunction(id);
+    Table* current = table.load(memory_order_acquire);
+    Node* node = current->buckets[hash & (current->size - 1)].load(memory_order_acquire);
+    while (node != nullptr) {
+        if (node->id == id) {
+            found = node->client;
+            return true;
+        }
+        node = node->next.load(memory_order_acquire);
+    }
+    found = nullptr;
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// remove
+// Unlinks the node under its stripe lock; node and client are retired, not
+// freed, since readers may be looking at them
+// Client removed if found, returns success status
+bool ConcurrentClientStorage::remove(ClientID id) {
+    uint64_t hash = hashFunction(id);
+    Node* removed = nullptr;
+    {
+        lock_guard<mutex> lock(stripeFor(hash).lock);
+        Table* current = table.load(memory_order_acquire);
+        atomic<Node*>* link = &current->buckets[hash & (current->size - 1)];
+        for (Node* node = link->load(memory_order_relaxed); node != nullptr;
+             node = link->load(memory_order_relaxed)) {
+            if (node->id == id) {
+                link->store(node->next.load(memory_order_relaxed), memory_order_release);
+                removed = node;
+                break;
+            }
+            link = &node->next;
+        }
+    }
+    if (removed == nullptr) {
+        return false; // Client not found
+    }
+
+    count.fetch_sub(1, memory_order_relaxed);
+    retire(removed, removed->client, nullptr);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// lockAll / unlockAll
+// Stripes are always taken in index order, so two threads can't deadlock
+void ConcurrentClientStorage::lockAll() {
+    for (size_t i = 0; i < STRIPE_COUNT; ++i) {
+        stripes[i].lock.lock();
+    }
+}
+
+void ConcurrentClientStorage::unlockAll() {
+    for (size_t i = STRIPE_COUNT; i > 0; --i) {
+        stripes[i - 1].lock.unlock();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// growIfNeeded
+// Copies every chain into an array twice the size and publishes it;
+// readers on the old array still find every client there until it is
+// reclaimed
+void ConcurrentClientStorage::growIfNeeded() {
+    if (count.load(memory_order_relaxed) <= table.load(memory_order_acquire)->size) {
+        return;
+    }
+
+    lockAll();
+    Table* current = table.load(memory_order_relaxed);
+    if (count.load(memory_order_relaxed) <= current->size) {
+        unlockAll();                  // Another writer grew it first
+        return;
+    }
+
+    Table* grown = new Table(current->size * 2);
+    size_t mask = grown->size - 1;
+    for (size_t i = 0; i < current->size; ++i) {
+        for (Node* node = current->buckets[i].load(memory_order_relaxed); node != nullptr;
+             node = node->next.load(memory_order_relaxed)) {
+            atomic<Node*>& head = grown->buckets[hashFunction(node->id) & mask];
+            head.store(new Node(node->id, node->client, head.load(memory_order_relaxed)),
+                       memory_order_relaxed);
+        }
+    }
+    table.store(grown, memory_order_release);
+    unlockAll();
+
+    {
+        lock_guard<mutex> lock(retiring);
+        resizes.push_back(grown->size);
+    }
+    retire(nullptr, nullptr, current);
+}
+
+// ----------------------------------------------------------------------------
+// retire
+// Queues whatever is non-null; reclaims when the queue reaches a batch
+void ConcurrentClientStorage::retire(Node* node, Client* client, Table* oldTable) {
+    bool batchFull;
+    {
+        lock_guard<mutex> lock(retiring);
+        if (node != nullptr) {
+            retiredNodes.push_back(node);
+        }
+        if (client != nullptr) {
+            retiredClients.push_back(client);
+        }
+        if (oldTable != nullptr) {
+            retiredTables.push_back(oldTable);
+        }
+        batchFull = retiredNodes.size() + retiredClients.size() + retiredTables.size() >= RECLAIM_BATCH;
+    }
+    if (batchFull) {
+        reclaim();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// reclaim
+// Takes the current batch, waits for a grace period and frees it. A caller
+// inside a read section cannot wait, so the batch goes back for later
+void ConcurrentClientStorage::reclaim() {
+    vector<Node*> nodes;
+    vector<Client*> clients;
+    vector<Table*> tables;
+    {
+        lock_guard<mutex> lock(retiring);
+        nodes.swap(retiredNodes);
+        clients.swap(retiredClients);
+        tables.swap(retiredTables);
+    }
+
+    if (!epochs.synchronize()) {
+        lock_guard<mutex> lock(retiring);
+        retiredNodes.insert(retiredNodes.end(), nodes.begin(), nodes.end());
+        retiredClients.insert(retiredClients.end(), clients.begin(), clients.end());
+        retiredTables.insert(retiredTables.end(), tables.begin(), tables.end());
+        return;
+    }
+
+    for (Node* node : nodes) {
+        delete node;
+    }
+    for (Client* client : clients) {
+        delete client;
+    }
+    for (Table* retired : tables) {
+        delete retired;
+    }
+    lock_guard<mutex> lock(retiring);
+    reclaimed += nodes.size() + clients.size() + tables.size();
+}
+
+// ----------------------------------------------------------------------------
+// collectAll
+// Walks the current array in bucket order
+// All clients appended to found in the same order display shows them
+void ConcurrentClientStorage::collectAll(vector<Client*>& found) const {
+    ReadGuard guard(*this);
+    Table* current = table.load(memory_order_acquire);
+    for (size_t i = 0; i < current->size; ++i) {
+        for (Node* node = current->buckets[i].load(memory_order_acquire); node != nullptr;
+             node = node->next.load(memory_order_acquire)) {
+            found.push_back(node->client);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// display
+// Displays all clients in bucket order
+void ConcurrentClientStorage::display(OutputSink& out) const {
+    vector<Client*> all;
+    collectAll(all);
+    for (const Client* client : all) {
+        client->display(out);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// size
+// Returns number of clients stored
+size_t ConcurrentClientStorage::size() const {
+    return count.load(memory_order_relaxed);
+}
+
+// ----------------------------------------------------------------------------
+// displayStats
+// Bucket usage of the current array, growth history and reclamation
+void ConcurrentClientStorage::displayStats(OutputSink& out) const {
+    ReadGuard guard(*this);
+    Table* current = table.load(memory_order_acquire);
+    size_t usedBuckets = 0;
+    size_t maxChainLength = 0;
+    for (size_t i = 0; i < current->size; ++i) {
+        size_t chainLength = 0;
+        for (Node* node = current->buckets[i].load(memory_order_acquire); node != nullptr;
+             node = node->next.load(memory_order_acquire)) {
+            chainLength++;
+        }
+        if (chainLength > 0) {
+            usedBuckets++;
+        }
+        if (chainLength > maxChainLength) {
+            maxChainLength = chainLength;
+        }
+    }
+
+    out << "Concurrent Hash Table Statistics:\n";
+    out << "Total buckets: " << current->size << '\n';
+    out << "Used buckets: " << usedBuckets << '\n';
+    out << "Total clients: " << size() << '\n';
+    out << "Max chain length: " << maxChainLength << '\n';
+    out << "Lock stripes: " << STRIPE_COUNT << '\n';
+
+    lock_guard<mutex> lock(retiring);
+    out << "Resizes: " << resizes.size() << '\n';
+    for (size_t buckets : resizes) {
+        out << "  -> " << buckets << " buckets\n";
+    }
+    out << "Epoch: " << epochs.getEpoch() << '\n';
+    out << "Retired awaiting reclaim: "
+        << retiredNodes.size() + retiredClients.size() + retiredTables.size() << '\n';
+    out << "Reclaimed: " << reclaimed << '\n';
+}
+
+// ----------------------------------------------------------------------------
+// clear
+// Publishes an empty array, then retires the old one with its clients
+void ConcurrentClientStorage::clear() {
+    lockAll();
+    Table* old = table.load(memory_order_relaxed);
+    table.store(new Table(MIN_BUCKETS), memory_order_release);
+    count.store(0, memory_order_relaxed);
+    unlockAll();
+
+    for (size_t i = 0; i < old->size; ++i) {
+        for (Node* node = old->buckets[i].load(memory_order_relaxed); node != nullptr;
+             node = node->next.load(memory_order_relaxed)) {
+            retire(nullptr, node->client, nullptr);
+        }
+    }
+    retire(nullptr, nullptr, old);
+}
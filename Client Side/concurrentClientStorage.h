@@ -0,0 +1,146 @@
+/*
+ -----------------------------------------------------------------------------
+ File: concurrentClientStorage.h
+ Description: Thread-safe storage policy for ClientHash, for running
+              commands on several threads. Lookups take no locks: they
+              follow atomic bucket and chain pointers inside an
+              EpochDomain read section. Writers lock one of STRIPE_COUNT
+              stripes (a bucket's stripe is fixed by the low bits of its
+              hash) and publish a new chain head or link with a release
+              store. Growing copies the chains into a new bucket array and
+              publishes it with one pointer store. Removed nodes, removed
+              clients and replaced arrays go on a retired list, and are
+              freed in batches once the epoch domain shows that no reader
+              can still reach them.
+ Author: Sharjeel Khan
+ Assumptions: A client from retrieve stays valid while the caller holds a
+              ReadGuard; without one, only until another thread removes it
+              collectAll, display, displayStats and clear expect no
+              concurrent writers
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef CONCURRENT_CLIENT_STORAGE_H
+#define CONCURRENT_CLIENT_STORAGE_H
+
+#include "client.h"
+#include "epochDomain.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+class ConcurrentClientStorage {
+public:
+    // Keeps clients returned by retrieve alive while in scope
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const ConcurrentClientStorage& storage)
+            : domain(storage.epochs), ticket(storage.epochs.enter()) {}
+        ~ReadGuard() { domain.exit(ticket); }
+
+    private:
+        EpochDomain& domain;
+        unsigned ticket;
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+    };
+
+    // Default Constructor
+    ConcurrentClientStorage();
+
+    // Destructor; no other thread may still use the storage
+    ~ConcurrentClientStorage();
+
+    // Inserts client under its stripe lock, growing afterwards if needed
+    bool insert(Client* client);
+
+    // Finds client by ID without locking
+    bool retrieve(ClientID id, Client*& found) const;
+
+    // Unlinks client under its stripe lock and retires it
+    bool remove(ClientID id);
+
+    // Appends every client to found in bucket order
+    void collectAll(vector<Client*>& found) const;
+
+    // Appends all clients to out in bucket order (no heading)
+    void display(OutputSink& out) const;
+
+    // Returns number of clients stored
+    size_t size() const;
+
+    // Appends bucket, resize and reclamation statistics to out
+    void displayStats(OutputSink& out) const;
+
+    // Removes all clients
+    void clear();
+
+private:
+    static const size_t STRIPE_COUNT = 64;      // Writer locks (power of two)
+    static const size_t MIN_BUCKETS = 1024;     // Initial array, a power of
+                                                // two and >= STRIPE_COUNT
+    static const size_t RECLAIM_BATCH = 64;     // Retired items per reclaim
+    static const size_t CACHE_LINE = 64;
+
+    // Chain node; id is copied in so lookups don't touch the client
+    struct Node {
+        ClientID id;
+        Client* client;
+        atomic<Node*> next;
+
+        Node(ClientID id, Client* client, Node* next) : id(id), client(client), next(next) {}
+    };
+
+    // Bucket array; published whole, so a reader sees one consistent size
+    struct Table {
+        size_t size;                  // Buckets, a power of two
+        atomic<Node*>* buckets;       // Chain heads
+
+        explicit Table(size_t size);
+        ~Table();                     // Deletes nodes, not clients
+    };
+
+    struct alignas(CACHE_LINE) Stripe {
+        mutex lock;
+    };
+
+    atomic<Table*> table;             // Current bucket array
+    Stripe stripes[STRIPE_COUNT];     // Writers lock the stripe of a bucket
+    atomic<size_t> count;             // Clients stored
+    mutable EpochDomain epochs;       // Read sections of lookups
+
+    mutable mutex retiring;           // Guards retired lists and history
+    vector<Node*> retiredNodes;       // Unlinked, awaiting a grace period
+    vector<Client*> retiredClients;
+    vector<Table*> retiredTables;
+    size_t reclaimed;                 // Items freed so far
+    vector<size_t> resizes;           // Bucket count after each growth
+
+    // Mixes id so both bucket and stripe depend on every ID bit
+    static uint64_t hashFunction(ClientID id);
+
+    // Returns stripe guarding buckets of hash
+    Stripe& stripeFor(uint64_t hash);
+
+    // Locks every stripe (in index order) to freeze the table
+    void lockAll();
+    void unlockAll();
+
+    // Doubles the bucket array if clients outnumber buckets
+    void growIfNeeded();
+
+    // Adds to the retired lists, reclaiming once a batch has built up
+    void retire(Node* node, Client* client, Table* oldTable);
+
+    // Waits out current readers, then frees what was retired before
+    void reclaim();
+
+    // Storage is shared by reference, copying is not supported
+    ConcurrentClientStorage(const ConcurrentClientStorage&) = delete;
+    ConcurrentClientStorage& operator=(const ConcurrentClientStorage&) = delete;
+};
+
+#endif // CONCURRENT_CLIENT_STORAGE_H
@@ -0,0 +1,113 @@
+/*
+-----------------------------------------------------------------------------
+ File: directClientStorage.cpp
+ Description: Implementation of DirectClientStorage. Slot i holds the
+              client with ID DIRECT_MIN_ID + i.
+ Author: Sharjeel Khan
+ Assumptions: Memory for the fixed slot array is part of the object
+ -----------------------------------------------------------------------------
+*/
+
+#include "directClientStorage.h"
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+// Default Constructor
+// Initializes every slot empty
+DirectClientStorage::DirectClientStorage() : count(0) {
+    for (size_t i = 0; i < SLOT_COUNT; ++i) {
+        slots[i] = nullptr;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Cleans up all stored clients
+DirectClientStorage::~DirectClientStorage() {
+    clear();
+}
+
+// ----------------------------------------------------------------------------
+// insert
+// Client stored if its ID is in range and its slot is free
+bool DirectClientStorage::insert(Client* client) {
+    if (client == nullptr) {
+        return false;
+    }
+    ClientID id = client->getID();
+    if (id < DIRECT_MIN_ID || id > DIRECT_MAX_ID || slots[id - DIRECT_MIN_ID] != nullptr) {
+        return false; // Out of range or duplicate ID, don't insert
+    }
+    slots[id - DIRECT_MIN_ID] = client;
+    count++;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// remove
+// Client removed and deallocated if found
+bool DirectClientStorage::remove(ClientID id) {
+    Client* client;
+    if (!retrieve(id, client)) {
+        return false; // Client not found
+    }
+    delete client;
+    slots[id - DIRECT_MIN_ID] = nullptr;
+    count--;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// collectAll
+// Walks slots in ID order
+// All clients appended to found in the same order display shows them
+void DirectClientStorage::collectAll(vector<Client*>& found) const {
+    for (size_t i = 0; i < SLOT_COUNT; ++i) {
+        if (slots[i] != nullptr) {
+            found.push_back(slots[i]);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// display
+// Displays all clients in ID order
+void DirectClientStorage::display(OutputSink& out) const {
+    for (size_t i = 0; i < SLOT_COUNT; ++i) {
+        if (slots[i] != nullptr) {
+            slots[i]->display(out);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// size
+// Returns number of occupied slots
+size_t DirectClientStorage::size() const {
+    return count;
+}
+
+// ----------------------------------------------------------------------------
+// displayStats
+// Shows slot usage; every lookup reads exactly one slot
+void DirectClientStorage::displayStats(OutputSink& out) const {
+    out << "Direct Index Statistics:\n";
+    out << "ID range: " << DIRECT_MIN_ID << '-' << DIRECT_MAX_ID << '\n';
+    out << "Total slots: " << SLOT_COUNT << '\n';
+    out << "Total clients: " << count << '\n';
+    if (count > 0) {
+        out << "Load factor: " << (double)count / SLOT_COUNT << '\n';
+    }
+}
+
+// ----------------------------------------------------------------------------
+// clear
+// All clients deallocated, every slot empty
+void DirectClientStorage::clear() {
+    for (size_t i = 0; i < SLOT_COUNT; ++i) {
+        delete slots[i];
+        slots[i] = nullptr;
+    }
+    count = 0;
+}
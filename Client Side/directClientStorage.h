@@ -0,0 +1,77 @@
+/*
+ -----------------------------------------------------------------------------
+ File: directClientStorage.h
+ Description: Direct-index storage policy for ClientHash, for branches
+              whose clients all have dense 4-digit IDs. Each ID from
+              DIRECT_MIN_ID to DIRECT_MAX_ID owns one slot of a fixed
+              array, so there is no hashing or probing and a lookup is a
+              range check plus a single load.
+ Author: Sharjeel Khan
+ Assumptions: Client IDs are 1000-9999; insert returns false for any other
+              ID, and ClientManager::holdsID tells that apart from a
+              duplicate
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef DIRECT_CLIENT_STORAGE_H
+#define DIRECT_CLIENT_STORAGE_H
+
+#include "client.h"
+#include <cstddef>
+#include <vector>
+
+class DirectClientStorage {
+public:
+    // Single-threaded storage, reads need no protection
+    struct ReadGuard {
+        explicit ReadGuard(const DirectClientStorage&) {}
+    };
+
+    static const ClientID DIRECT_MIN_ID = 1000;   // First ID with a slot
+    static const ClientID DIRECT_MAX_ID = 9999;   // Last ID with a slot
+
+    // Default Constructor
+    DirectClientStorage();
+
+    // Destructor
+    ~DirectClientStorage();
+
+    // Stores client in the slot of its ID
+    bool insert(Client* client);
+
+    // Finds client by ID; inline so a lookup compiles to one load
+    bool retrieve(ClientID id, Client*& found) const {
+        found = id >= DIRECT_MIN_ID && id <= DIRECT_MAX_ID ? slots[id - DIRECT_MIN_ID] : nullptr;
+        return found != nullptr;
+    }
+
+    // Removes client with specified ID
+    bool remove(ClientID id);
+
+    // Appends every client to found in ID order
+    void collectAll(vector<Client*>& found) const;
+
+    // Appends all clients to out in ID order (no heading)
+    void display(OutputSink& out) const;
+
+    // Returns number of clients stored
+    size_t size() const;
+
+    // Appends slot usage statistics to out
+    void displayStats(OutputSink& out) const;
+
+    // Removes all clients
+    void clear();
+
+private:
+    static const size_t SLOT_COUNT = DIRECT_MAX_ID - DIRECT_MIN_ID + 1;
+
+    Client* slots[SLOT_COUNT];        // Client of each ID, or nullptr
+    size_t count;                     // Occupied slots
+
+    // Storage owns its clients, copying is not supported
+    DirectClientStorage(const DirectClientStorage&) = delete;
+    DirectClientStorage& operator=(const DirectClientStorage&) = delete;
+};
+
+#endif // DIRECT_CLIENT_STORAGE_H
@@ -0,0 +1,98 @@
+/*
+-----------------------------------------------------------------------------
+ File: epochDomain.cpp
+ Description: Implementation of EpochDomain. A ticket is the parity of the
+              epoch the reader entered under. synchronize advances the
+              epoch, then waits for the old parity's counters to drain.
+              Readers of the parity before that drained during the
+              previous synchronize, so only readers that entered before
+              this advance are waited for.
+ Author: Sharjeel Khan
+ Assumptions: The increment and epoch check in enter, and the epoch
+              advance and counter scan in synchronize, are all sequentially
+              consistent, so a writer either sees a reader's count or the
+              reader sees the new epoch and retries
+ -----------------------------------------------------------------------------
+*/
+
+#include "epochDomain.h"
+#include <functional>
+#include <thread>
+
+using namespace std;
+
+// Enter calls the current thread has not yet exited, in any domain
+static thread_local int readDepth = 0;
+
+// ----------------------------------------------------------------------------
+// Constructor
+// Initializes epoch 0 with every reader counter zero
+EpochDomain::EpochDomain() : epoch(0) {
+    for (size_t i = 0; i < SLOT_COUNT; ++i) {
+        slots[i].readers[0] = 0;
+        slots[i].readers[1] = 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// slotIndex
+// Hash of the thread ID, computed once per thread
+size_t EpochDomain::slotIndex() {
+    static thread_local size_t index = hash<thread::id>()(this_thread::get_id()) % SLOT_COUNT;
+    return index;
+}
+
+// ----------------------------------------------------------------------------
+// enter
+// Counts the reader under the current epoch's parity; if the epoch moved
+// meanwhile, the count may have been missed, so it is moved to the new one
+// Returns parity ticket for exit
+unsigned EpochDomain::enter() {
+    ReaderSlot& slot = slots[slotIndex()];
+    readDepth++;
+    for (;;) {
+        uint64_t observed = epoch.load();
+        unsigned parity = (unsigned)(observed & 1);
+        slot.readers[parity].fetch_add(1);
+        if (epoch.load() == observed) {
+            return parity;
+        }
+        slot.readers[parity].fetch_sub(1, memory_order_release);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// exit
+// Releases the count taken by enter
+void EpochDomain::exit(unsigned ticket) {
+    slots[slotIndex()].readers[ticket].fetch_sub(1, memory_order_release);
+    readDepth--;
+}
+
+// ----------------------------------------------------------------------------
+// synchronize
+// Advances the epoch and spins until the previous parity has no readers.
+// The scan loads are seq_cst: an acquire load could miss a reader whose
+// increment precedes its check of the old epoch (store then load on both
+// sides)
+// Returns false if the caller is itself a reader
+bool EpochDomain::synchronize() {
+    if (readDepth > 0) {
+        return false;
+    }
+    lock_guard<mutex> lock(synchronizing);
+    unsigned oldParity = (unsigned)(epoch.fetch_add(1) & 1);
+    for (size_t i = 0; i < SLOT_COUNT; ++i) {
+        while (slots[i].readers[oldParity].load(memory_order_seq_cst) != 0) {
+            this_thread::yield();
+        }
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// getEpoch
+// Returns number of completed epoch advances
+uint64_t EpochDomain::getEpoch() const {
+    return epoch.load(memory_order_relaxed);
+}
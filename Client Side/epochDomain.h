@@ -0,0 +1,69 @@
+/*
+ -----------------------------------------------------------------------------
+ File: epochDomain.h
+ Description: Epoch-based reclamation for lock-free readers. A reader
+              enters the domain before touching shared nodes and exits when
+              done; entering costs one counter increment on a cache line
+              picked by the reading thread. A writer that has unlinked
+              nodes calls synchronize, which advances the epoch and waits
+              until every reader that entered under the old epoch has
+              exited; after that nothing unlinked before the call can still
+              be reached, and it may be freed.
+ Author: Sharjeel Khan
+ Assumptions: Readers hold the domain briefly (a lookup, or one command)
+              A thread that is inside the domain cannot synchronize (it
+              would wait for itself); synchronize reports this instead
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef EPOCH_DOMAIN_H
+#define EPOCH_DOMAIN_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+using namespace std;
+
+class EpochDomain {
+public:
+    // Creates domain at epoch 0 with no readers
+    EpochDomain();
+
+    // Marks calling thread as reading; returns ticket to pass to exit
+    unsigned enter();
+
+    // Ends the read started by the enter call that returned ticket
+    void exit(unsigned ticket);
+
+    // Waits until readers that entered before this call have exited.
+    // Returns false without waiting if the calling thread is inside any
+    // domain
+    bool synchronize();
+
+    // Returns current epoch (number of completed synchronize calls)
+    uint64_t getEpoch() const;
+
+private:
+    static const size_t SLOT_COUNT = 64;        // Reader counter stripes
+    static const size_t CACHE_LINE = 64;
+
+    // Readers currently inside, by parity of the epoch they entered under
+    struct alignas(CACHE_LINE) ReaderSlot {
+        atomic<uint32_t> readers[2];
+    };
+
+    atomic<uint64_t> epoch;           // Advanced by synchronize
+    ReaderSlot slots[SLOT_COUNT];     // Threads spread over slots by ID
+    mutex synchronizing;              // One epoch advance at a time
+
+    // Returns calling thread's slot
+    static size_t slotIndex();
+
+    // Domains are shared by reference, copying is not supported
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+};
+
+#endif // EPOCH_DOMAIN_H
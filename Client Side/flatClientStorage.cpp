@@ -0,0 +1,346 @@
+/*
+-----------------------------------------------------------------------------
+ File: flatClientStorage.cpp
+ Description: Implementation of FlatClientStorage. Lookups start at a group
+              picked by the high hash bits and step through groups in
+              triangular order, which visits every group of a power-of-two
+              table exactly once. A group with an empty slot ends the probe.
+ Author: Sharjeel Khan
+ Assumptions: Table is kept at most 7/8 full, counting tombstones, so every
+              probe reaches an empty slot
+ -----------------------------------------------------------------------------
+*/
+
+#include "flatClientStorage.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#define SSSS_HAVE_SSE2 1
+#endif
+
+using namespace std;
+
+// Constants
+const uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ull;  // 2^64 / golden ratio
+const int HASH_BITS_SHIFT = 7;        // Low 7 bits go to the control byte
+const int8_t HASH_BITS_MASK = 0x7F;
+const size_t MAX_LOAD_NUMERATOR = 7;  // Grow past 7/8 full
+const size_t MAX_LOAD_DENOMINATOR = 8;
+
+// ----------------------------------------------------------------------------
+// Default Constructor
+// Initializes empty table; arrays are allocated on first insert
+FlatClientStorage::FlatClientStorage()
+    : control(nullptr), ids(nullptr), records(nullptr),
+      capacity(0), count(0), tombstones(0) {
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Cleans up all hash table resources
+FlatClientStorage::~FlatClientStorage() {
+    release();
+}
+
+// ----------------------------------------------------------------------------
+// hashFunction
+// Fibonacci hashing: multiply, then fold the high half into the low half so
+// both the group index and the control bits depend on every ID bit
+uint64_t FlatClientStorage::hashFunction(ClientID id) {
+    uint64_t hash = (uint64_t)id * HASH_MULTIPLIER;
+    return hash ^ (hash >> 32);
+}
+
+// ----------------------------------------------------------------------------
+// matchByte
+// Compares all GROUP_WIDTH control bytes with value in one SSE2 compare
+// Returns mask with bit i set where group[i] == value
+uint32_t FlatClientStorage::matchByte(const int8_t* group, int8_t value) {
+#ifdef SSSS_HAVE_SSE2
+    __m128i bytes = _mm_loadu_si128((const __m128i*)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value)));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+        mask |= (uint32_t)(group[i] == value) << i;
+    }
+    return mask;
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// matchFree
+// Empty and deleted bytes are the negative ones, so the sign bits are the
+// answer
+// Returns mask with bit i set where group[i] is empty or deleted
+uint32_t FlatClientStorage::matchFree(const int8_t* group) {
+#ifdef SSSS_HAVE_SSE2
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+        mask |= (uint32_t)(group[i] < 0) << i;
+    }
+    return mask;
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// findSlot
+// Checks IDs only where the control byte matches the hash bits; stops at
+// the first group that has an empty slot
+// Returns slot holding id, or capacity if absent
+size_t FlatClientStorage::findSlot(ClientID id) const {
+    if (capacity == 0) {
+        return capacity;
+    }
+    uint64_t hash = hashFunction(id);
+    int8_t hashBits = (int8_t)(hash & HASH_BITS_MASK);
+    size_t mask = capacity - 1;
+    size_t position = (hash >> HASH_BITS_SHIFT) & mask;
+
+    for (size_t step = GROUP_WIDTH; ; step += GROUP_WIDTH) {
+        const int8_t* group = control + position;
+        for (uint32_t matches = matchByte(group, hashBits); matches != 0;
+             matches &= matches - 1) {
+            size_t slot = (position + __builtin_ctz(matches)) & mask;
+            if (ids[slot] == id) {
+                return slot;
+            }
+        }
+        if (matchByte(group, EMPTY) != 0) {
+            return capacity;
+        }
+        position = (position + step) & mask;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// findFreeSlot
+// Walks the same probe sequence as findSlot
+// Returns first empty or deleted slot for hash
+size_t FlatClientStorage::findFreeSlot(uint64_t hash) const {
+    size_t mask = capacity - 1;
+    size_t position = (hash >> HASH_BITS_SHIFT) & mask;
+
+    for (size_t step = GROUP_WIDTH; ; step += GROUP_WIDTH) {
+        uint32_t available = matchFree(control + position);
+        if (available != 0) {
+            return (position + __builtin_ctz(available)) & mask;
+        }
+        position = (position + step) & mask;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// setControl
+// The first GROUP_WIDTH bytes are copied past the end so a group loaded
+// near the end of the table sees the start of the table
+void FlatClientStorage::setControl(size_t slot, int8_t value) {
+    control[slot] = value;
+    if (slot < GROUP_WIDTH) {
+        control[capacity + slot] = value;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// insert
+// Rehashes first if the new client would pass the load limit, then moves
+// the client into the first free slot of its probe sequence
+// Client inserted and passed object deleted if not duplicate
+bool FlatClientStorage::insert(Client* client) {
+    if (client == nullptr) {
+        return false;
+    }
+    ClientID id = client->getID();
+    if (findSlot(id) != capacity) {
+        return false; // Duplicate ID found, don't insert
+    }
+
+    if ((count + tombstones + 1) * MAX_LOAD_DENOMINATOR > capacity * MAX_LOAD_NUMERATOR) {
+        // Mostly tombstones: clean up in place, otherwise double
+        size_t needed = (count + 1) * MAX_LOAD_DENOMINATOR;
+        size_t newCapacity = capacity == 0 ? MIN_CAPACITY : capacity;
+        while (needed > newCapacity * MAX_LOAD_NUMERATOR / 2) {
+            newCapacity *= 2;
+        }
+        if (capacity > 0) {
+            resizes.push_back(Resize{capacity, newCapacity, count});
+        }
+        rehash(newCapacity);
+    }
+
+    uint64_t hash = hashFunction(id);
+    size_t slot = findFreeSlot(hash);
+    if (control[slot] == DELETED) {
+        tombstones--;
+    }
+    setControl(slot, (int8_t)(hash & HASH_BITS_MASK));
+    ids[slot] = id;
+    records[slot] = move(*client);
+    count++;
+
+    delete client;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// retrieve
+// Searches for client by ID in hash table
+// found points to matching Client or nullptr, returns success status
+bool FlatClientStorage::retrieve(ClientID id, Client*& found) const {
+    size_t slot = findSlot(id);
+    if (slot == capacity) {
+        found = nullptr;
+        return false;
+    }
+    found = &records[slot];
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// remove
+// Leaves a tombstone so probes for other IDs continue past the slot
+// Client removed if found, returns success status
+bool FlatClientStorage::remove(ClientID id) {
+    size_t slot = findSlot(id);
+    if (slot == capacity) {
+        return false; // Client not found
+    }
+    setControl(slot, DELETED);
+    records[slot] = Client();
+    count--;
+    tombstones++;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// collectAll
+// Walks slots in order
+// All clients appended to found in the same order display shows them
+void FlatClientStorage::collectAll(vector<Client*>& found) const {
+    for (size_t i = 0; i < capacity; ++i) {
+        if (control[i] >= 0) {
+            found.push_back(&records[i]);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// display
+// Displays all clients in slot order
+// All clients displayed with their information
+void FlatClientStorage::display(OutputSink& out) const {
+    for (size_t i = 0; i < capacity; ++i) {
+        if (control[i] >= 0) {
+            records[i].display(out);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// size
+// Returns number of full slots
+size_t FlatClientStorage::size() const {
+    return count;
+}
+
+// ----------------------------------------------------------------------------
+// displayStats
+// Probe length is the number of groups a lookup of each client reads
+// Slot usage and probe statistics displayed
+void FlatClientStorage::displayStats(OutputSink& out) const {
+    size_t totalGroups = 0;
+    size_t maxGroups = 0;
+    size_t mask = capacity - 1;
+
+    for (size_t i = 0; i < capacity; ++i) {
+        if (control[i] < 0) {
+            continue;
+        }
+        size_t position = (hashFunction(ids[i]) >> HASH_BITS_SHIFT) & mask;
+        size_t groups = 1;
+        for (size_t step = GROUP_WIDTH; ((i - position) & mask) >= GROUP_WIDTH;
+             step += GROUP_WIDTH) {
+            position = (position + step) & mask;
+            groups++;
+        }
+        totalGroups += groups;
+        if (groups > maxGroups) {
+            maxGroups = groups;
+        }
+    }
+
+    out << "Hash Table Statistics:\n";
+    out << "Total slots: " << capacity << '\n';
+    out << "Total clients: " << count << '\n';
+    out << "Deleted slots: " << tombstones << '\n';
+    out << "Max probe length (groups): " << maxGroups << '\n';
+    if (count > 0) {
+        out << "Average probe length (groups): " << (double)totalGroups / count << '\n';
+        out << "Load factor: " << (double)count / capacity << '\n';
+    }
+    out << "Resizes: " << resizes.size() << '\n';
+    for (const Resize& resize : resizes) {
+        out << "  " << resize.fromSlots << " -> " << resize.toSlots
+            << " slots at " << resize.clients << " clients\n";
+    }
+}
+
+// ----------------------------------------------------------------------------
+// clear
+// Removes all elements from hash table
+// All clients deallocated, table reset to empty
+void FlatClientStorage::clear() {
+    release();
+}
+
+// ----------------------------------------------------------------------------
+// rehash
+// Moves every client into fresh arrays; no ID can be a duplicate, so each
+// goes straight to its first free slot
+// Table has newCapacity slots and no tombstones
+void FlatClientStorage::rehash(size_t newCapacity) {
+    int8_t* oldControl = control;
+    ClientID* oldIds = ids;
+    Client* oldRecords = records;
+    size_t oldCapacity = capacity;
+
+    control = new int8_t[newCapacity + GROUP_WIDTH];
+    ids = new ClientID[newCapacity];
+    records = new Client[newCapacity];
+    capacity = newCapacity;
+    tombstones = 0;
+    for (size_t i = 0; i < newCapacity + GROUP_WIDTH; ++i) {
+        control[i] = EMPTY;
+    }
+
+    for (size_t i = 0; i < oldCapacity; ++i) {
+        if (oldControl[i] >= 0) {
+            uint64_t hash = hashFunction(oldIds[i]);
+            size_t slot = findFreeSlot(hash);
+            setControl(slot, (int8_t)(hash & HASH_BITS_MASK));
+            ids[slot] = oldIds[i];
+            records[slot] = move(oldRecords[i]);
+        }
+    }
+
+    delete[] oldControl;
+    delete[] oldIds;
+    delete[] oldRecords;
+}
+
+// ----------------------------------------------------------------------------
+// release
+// Frees all arrays and resets counters
+void FlatClientStorage::release() {
+    delete[] control;
+    delete[] ids;
+    delete[] records;
+    control = nullptr;
+    ids = nullptr;
+    records = nullptr;
+    capacity = 0;
+    count = 0;
+    tombstones = 0;
+}
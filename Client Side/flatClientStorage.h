@@ -0,0 +1,118 @@
+/*
+ -----------------------------------------------------------------------------
+ File: flatClientStorage.h
+ Description: Open-addressing storage policy for ClientHash in the style of
+              a Swiss table. IDs, clients and one control byte per slot are
+              kept in three parallel arrays; the control byte holds 7 bits
+              of the hash, so a lookup compares a whole group of 16 slots
+              at once (SSE2 when available, a scalar loop otherwise) and
+              only reads IDs whose hash bits match. Clients are stored in
+              the table itself, with no per-client node allocation.
+ Author: Sharjeel Khan
+ Assumptions: Client pointers returned by retrieve stay valid until the
+              next insert, which may move every client when the table grows
+              Removed slots become tombstones until the next rehash
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef FLAT_CLIENT_STORAGE_H
+#define FLAT_CLIENT_STORAGE_H
+
+#include "client.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class FlatClientStorage {
+public:
+    // Single-threaded storage, reads need no protection
+    struct ReadGuard {
+        explicit ReadGuard(const FlatClientStorage&) {}
+    };
+
+    // Default Constructor
+    FlatClientStorage();
+
+    // Destructor
+    ~FlatClientStorage();
+
+    // Moves client into the table using ID as key; on success the table
+    // owns the client and deletes the passed object
+    bool insert(Client* client);
+
+    // Finds client by ID in hash table
+    bool retrieve(ClientID id, Client*& found) const;
+
+    // Removes client with specified ID from hash table
+    bool remove(ClientID id);
+
+    // Appends every client to found in slot order
+    void collectAll(vector<Client*>& found) const;
+
+    // Appends all clients to out in slot order (no heading)
+    void display(OutputSink& out) const;
+
+    // Returns number of clients stored
+    size_t size() const;
+
+    // Appends hash table statistics, including every rehash, to out for
+    // debugging/analysis
+    void displayStats(OutputSink& out) const;
+
+    // Removes all elements from hash table
+    void clear();
+
+private:
+    static const size_t GROUP_WIDTH = 16;       // Control bytes per probe
+    static const size_t MIN_CAPACITY = 16;      // Smallest allocated table
+
+    // Control byte values; full slots hold 7 hash bits (0-127), so a
+    // negative byte is exactly an empty or deleted slot
+    static const int8_t EMPTY = -128;
+    static const int8_t DELETED = -2;
+
+    // One rehash: growth, or a same-size rebuild that drops tombstones
+    struct Resize {
+        size_t fromSlots;             // Slots before
+        size_t toSlots;               // Slots after
+        size_t clients;               // Clients when it happened
+    };
+
+    int8_t* control;                  // capacity + GROUP_WIDTH bytes; the
+                                      // tail mirrors the first group so a
+                                      // probe never wraps mid-group
+    ClientID* ids;                    // ID of each full slot
+    Client* records;                  // Client of each full slot
+    size_t capacity;                  // Slots, a power of two (0 if unused)
+    size_t count;                     // Full slots
+    size_t tombstones;                // Deleted slots
+    vector<Resize> resizes;           // Rehash history, oldest first
+
+    // Mixes id so nearby IDs land in different groups
+    static uint64_t hashFunction(ClientID id);
+
+    // Bit i set where group[i] equals value / is empty or deleted
+    static uint32_t matchByte(const int8_t* group, int8_t value);
+    static uint32_t matchFree(const int8_t* group);
+
+    // Returns slot holding id, or capacity if absent
+    size_t findSlot(ClientID id) const;
+
+    // Returns first empty or deleted slot on id's probe sequence
+    size_t findFreeSlot(uint64_t hash) const;
+
+    // Sets control byte of slot and its mirror
+    void setControl(size_t slot, int8_t value);
+
+    // Reallocates with newCapacity slots, dropping tombstones
+    void rehash(size_t newCapacity);
+
+    // Frees all arrays
+    void release();
+
+    // Tables own their clients, copying is not supported
+    FlatClientStorage(const FlatClientStorage&) = delete;
+    FlatClientStorage& operator=(const FlatClientStorage&) = delete;
+};
+
+#endif // FLAT_CLIENT_STORAGE_H
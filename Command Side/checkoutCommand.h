@@ -8,6 +8,7 @@
  Assumptions: MediaContainer can retrieve publications by type and data
               ClientManager can find clients by ID
               Command data format is "C clientID type format publicationData"
+              Command line outlives the command (data is a view of it)
  -----------------------------------------------------------------------------
 */
 
@@ -18,7 +19,7 @@
 #include "mediaContainer.h"
 #include "clientManager.h"
 
-class CheckoutCommand : public Command {
+class CheckoutCommand final : public Command {
 public:
 
     // Creates checkout command object
@@ -29,26 +30,25 @@ public:
     virtual ~CheckoutCommand();
 
     // Executes checkout command for specified client and publication
-    virtual bool execute(MediaContainer& publications, ClientManager& clients) override;
+    virtual bool execute(MediaContainer& publications, ClientManager& clients,
+                         OutputSink& out) override;
 
-    // Sets command data from string format "C clientID type format data"
-    virtual bool setData(const string& data) override;
+    // Sets command data from fields of "C clientID type format data"
+    virtual bool setData(const ParsedCommand& command) override;
     
     // Factory method to create new CheckoutCommand instance
     static Command* create();
 
 private:
-    int clientID;                     // ID of client checking out publication
+    ClientID clientID;                // ID of client checking out publication
     char publicationType;             // Type of publication ('F', 'C', 'P')
     char formatType;                  // Format type ('H' for hard copy)
-    string publicationData;           // Publication identification data
+    string_view publicationData;      // Publication identification data,
+                                      // viewing the command line
 
 
-    // Creates temporary publication object for searching
-    Media* createTargetPublication() const;
-    
-    // Extracts title from publication data for error messages
-    string extractTitle() const;
+    // Builds catalog lookup key from publicationData without allocating
+    bool createTargetKey(MediaKey& key) const;
 };
 
 #endif // CHECKOUT_COMMAND_H
\ No newline at end of file
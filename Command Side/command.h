@@ -6,13 +6,16 @@
 // Author: Sharjeel Khan
 // Assumptions: All commands operate on library data (publications and clients)
 //              Commands may succeed or fail and should report their status
-//              Command data is parsed from string format
+//              Command data is parsed from string format; parsed fields
+//              view the command line, which outlives the command
 // -----------------------------------------------------------------------------
 
 #ifndef COMMAND_H
 #define COMMAND_H
 
+#include "parsedCommand.h"
 #include <string>
+#include <string_view>
 #include <iostream>
 
 using namespace std;
@@ -20,6 +23,7 @@ using namespace std;
 // Forward declarations
 class MediaContainer;
 class ClientManager;
+class OutputSink;
 
 class Command {
 public:
@@ -31,12 +35,17 @@ public:
     virtual ~Command();
 
 
-    // Pure virtual method to execute the command
-    virtual bool execute(MediaContainer& publications, ClientManager& clients) = 0;
+    // Pure virtual method to execute the command, writing any output to out
+    virtual bool execute(MediaContainer& publications, ClientManager& clients,
+                         OutputSink& out) = 0;
     
  
-    // Pure virtual method to set command data from string
-    virtual bool setData(const string& data) = 0;
+    // Parses a command line in one pass and sets command data from its
+    // fields; the line must outlive the command
+    bool setData(string_view data);
+
+    // Pure virtual method to set command data from parsed fields
+    virtual bool setData(const ParsedCommand& command) = 0;
     
   
     // Returns error message if command execution failed
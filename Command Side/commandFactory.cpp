@@ -10,10 +10,6 @@
 // -----------------------------------------------------------------------------
 
 #include "commandFactory.h"
-#include "displayCommand.h"
-#include "historyCommand.h"
-#include "checkoutCommand.h"
-#include "returnCommand.h"
 #include <sstream>
 
 using namespace std;
@@ -102,33 +98,95 @@ Command* CommandFactory::createCommand(const string& commandData) const {
     return createCommand(commandType, commandData);
 }
 
+// ----------------------------------------------------------------------------
+// createCommand (slot)
+// Emplaces command for the line's type code in slot and initializes it
+// from the parsed fields
+// Returns true with slot holding the command, false with slot empty
+bool CommandFactory::createCommand(string_view line, const ParsedCommand& parsed,
+                                   CommandSlot& slot, OutputSink& out) const {
+    if (line.empty()) {
+        out << "ERROR: Empty command data.\n";
+        return false;
+    }
+
+    char commandType = line[0];
+    switch (commandType) {
+        case CHECKOUT_COMMAND:
+            slot.emplace<CheckoutCommand>();
+            break;
+
+        case RETURN_COMMAND:
+            slot.emplace<ReturnCommand>();
+            break;
+
+        case HISTORY_COMMAND:
+            slot.emplace<HistoryCommand>();
+            break;
+
+        case DISPLAY_COMMAND:
+            slot.emplace<DisplayCommand>();
+            break;
+
+        default:
+            out << "ERROR: '" << commandType << "' is not a valid command type.\n";
+            return false;
+    }
+
+    Command* command = getCommand(slot);
+    if (!command->setData(parsed)) {
+        out << "ERROR: " << command->getErrorMessage() << '\n';
+        slot = monostate();
+        return false;
+    }
+    return true;
+}
+
 // ----------------------------------------------------------------------------
 // processCommand
-// Creates and executes a single command from string data
+// Parses the line, then runs it as a pre-parsed command
 // Command executed if valid, error message displayed if invalid
-bool CommandFactory::processCommand(const string& commandData, MediaContainer& publications, ClientManager& clients) const {
+bool CommandFactory::processCommand(const string& commandData, MediaContainer& publications, ClientManager& clients,
+                                    OutputSink& out) const {
     // Skip empty lines
     if (commandData.empty()) {
         return true;
     }
+    return processCommand(commandData, ParsedCommand::parse(commandData), publications, clients, out);
+}
 
-    // Create command using factory
-    Command* command = createCommand(commandData);
-    if (command == nullptr) {
+// ----------------------------------------------------------------------------
+// processCommand (parsed)
+// Creates a single command in a stack slot and executes it through visit,
+// which calls each command type's execute directly
+// Command executed if valid, error message displayed if invalid
+bool CommandFactory::processCommand(string_view line, const ParsedCommand& parsed, MediaContainer& publications,
+                                    ClientManager& clients, OutputSink& out) const {
+    // Skip empty lines
+    if (line.empty()) {
+        return true;
+    }
+
+    // Create command in place
+    CommandSlot slot;
+    if (!createCommand(line, parsed, slot, out)) {
         return false;
     }
 
     // Execute the command
-    bool success = command->execute(publications, clients);
-    
+    bool success = visit([&](auto& command) {
+        if constexpr (is_same_v<decay_t<decltype(command)>, monostate>) {
+            return false;
+        } else {
+            return command.execute(publications, clients, out);
+        }
+    }, slot);
+
     if (!success) {
         // Display error message for failed commands
-        cout << "ERROR: " << command->getErrorMessage() << endl;
+        out << "ERROR: " << getCommand(slot)->getErrorMessage() << '\n';
     }
 
-    // Clean up command object
-    delete command;
-    
     return success;
 }
 
@@ -139,6 +197,7 @@ bool CommandFactory::processCommand(const string& commandData, MediaContainer& p
 int CommandFactory::processCommands(istream& input, MediaContainer& publications, ClientManager& clients) const {
     string line;
     int successfulCommands = 0;
+    OutputSink out(cout);
 
     // Process each line as a command
     while (getline(input, line)) {
@@ -147,14 +206,29 @@ int CommandFactory::processCommands(istream& input, MediaContainer& publications
             continue;
         }
 
-        if (processCommand(line, publications, clients)) {
+        if (processCommand(line, publications, clients, out)) {
             successfulCommands++;
         }
+        out.flush();                  // One write per command
     }
 
     return successfulCommands;
 }
 
+// ----------------------------------------------------------------------------
+// getCommand
+// Views the slot's command through the Command interface
+// Returns command pointer, nullptr for an empty slot
+Command* CommandFactory::getCommand(CommandSlot& slot) {
+    return visit([](auto& command) -> Command* {
+        if constexpr (is_same_v<decay_t<decltype(command)>, monostate>) {
+            return nullptr;
+        } else {
+            return &command;
+        }
+    }, slot);
+}
+
 // ----------------------------------------------------------------------------
 // isValidCommandType
 // Validates command type character
@@ -181,6 +255,14 @@ Command::Command() : errorMessage("") {
 Command::~Command() {
 }
 
+// ----------------------------------------------------------------------------
+// setData (line)
+// Slices the line once and hands the fields to the derived command
+// Returns derived setData result
+bool Command::setData(string_view data) {
+    return setData(ParsedCommand::parse(data));
+}
+
 // ----------------------------------------------------------------------------
 // getErrorMessage
 // Returns current error message
@@ -13,13 +13,23 @@
 #define COMMAND_FACTORY_H
 
 #include "command.h"
+#include "checkoutCommand.h"
+#include "returnCommand.h"
+#include "historyCommand.h"
+#include "displayCommand.h"
 #include "mediaContainer.h"
 #include "clientManager.h"
 #include <iostream>
 #include <string>
+#include <variant>
 
 using namespace std;
 
+// Storage for one built-in command of any type, held by value so the
+// command loop builds commands on the stack instead of the heap
+using CommandSlot = variant<monostate, CheckoutCommand, ReturnCommand,
+                            HistoryCommand, DisplayCommand>;
+
 class CommandFactory {
 public:
     // Creates command factory ready to create and process commands
@@ -34,17 +44,34 @@ public:
     // Creates command object and extracts type from command data string
     Command* createCommand(const string& commandData) const;
 
+    // Builds the command for line (already parsed into fields) in place in
+    // slot, writing errors to out; slot is left empty and false returned if
+    // the line is invalid
+    bool createCommand(string_view line, const ParsedCommand& parsed, CommandSlot& slot,
+                       OutputSink& out) const;
+
 
-    // Creates and executes a single command from string data
-    bool processCommand(const string& commandData, MediaContainer& publications, ClientManager& clients) const;
+    // Creates and executes a single command from string data, writing
+    // command output and errors to out. The command lives in a stack slot
+    // and is dispatched with visit, so no heap allocation is made
+    bool processCommand(const string& commandData, MediaContainer& publications, ClientManager& clients,
+                        OutputSink& out) const;
 
-    // Processes multiple commands from input stream
+    // Same as above for a line whose fields were parsed ahead of time
+    bool processCommand(string_view line, const ParsedCommand& parsed, MediaContainer& publications,
+                        ClientManager& clients, OutputSink& out) const;
+
+    // Processes multiple commands from input stream, flushing output to
+    // cout once per command
     int processCommands(istream& input, MediaContainer& publications, ClientManager& clients) const;
 
 private:
 
     // Checks if command type character is supported
     bool isValidCommandType(char commandType) const;
+
+    // Returns the command held in slot, nullptr if it is empty
+    static Command* getCommand(CommandSlot& slot);
 };
 
 #endif // COMMAND_FACTORY_H
\ No newline at end of file
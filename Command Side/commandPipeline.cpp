@@ -0,0 +1,115 @@
+// -----------------------------------------------------------------------------
+// File: commandPipeline.cpp
+// Description: Implementation of CommandPipeline. Blocks cycle from the free
+//              ring through the reader, parser and executor and back, so at
+//              most BLOCK_COUNT blocks are ever allocated.
+// Author: Sharjeel Khan
+// Assumptions: A line never spans two blocks; the reader keeps reading into
+//              the same block until it holds a newline or the input ends
+// -----------------------------------------------------------------------------
+
+#include "commandPipeline.h"
+#include "textScanner.h"
+#include <thread>
+
+// ----------------------------------------------------------------------------
+// Constructor
+// Pipeline runs commands through the given factory
+CommandPipeline::CommandPipeline(const CommandFactory& factory) : factory(factory) {
+}
+
+// ----------------------------------------------------------------------------
+// run
+// Starts reader and parser threads, executes parsed blocks in order on the
+// calling thread, then recycles each block back to the reader
+// Returns number of commands that succeeded
+int CommandPipeline::run(istream& input, MediaContainer& publications,
+                         ClientManager& clients) const {
+    CommandBlock blocks[BLOCK_COUNT];
+    BlockRing freeBlocks;
+    BlockRing filled;
+    BlockRing parsed;
+    for (size_t i = 0; i < BLOCK_COUNT; ++i) {
+        freeBlocks.push(&blocks[i]);
+    }
+
+    thread reader(readBlocks, ref(input), ref(freeBlocks), ref(filled));
+    thread parser(parseBlocks, ref(filled), ref(parsed));
+
+    OutputSink out(cout);
+    int successfulCommands = 0;
+    CommandBlock* block;
+    while ((block = parsed.pop()) != nullptr) {
+        for (const CommandLine& line : block->lines) {
+            if (factory.processCommand(line.text, line.parsed, publications, clients, out)) {
+                successfulCommands++;
+            }
+        }
+        out.flush();                  // One write per block
+        freeBlocks.push(block);
+    }
+
+    reader.join();
+    parser.join();
+    return successfulCommands;
+}
+
+// ----------------------------------------------------------------------------
+// readBlocks
+// Each block takes the partial line left by the previous one, then reads
+// BLOCK_SIZE at a time until it holds a newline; text after the last
+// newline carries over to the next block
+// Blocks pushed to filled in input order, followed by nullptr
+void CommandPipeline::readBlocks(istream& input, BlockRing& freeBlocks, BlockRing& filled) {
+    string carry;
+    bool done = false;
+
+    while (!done) {
+        CommandBlock* block = freeBlocks.pop();
+        string& text = block->text;
+        text.assign(carry);
+
+        size_t lastNewline = string::npos;
+        while (lastNewline == string::npos && !done) {
+            size_t start = text.size();
+            text.resize(start + BLOCK_SIZE);
+            input.read(&text[start], BLOCK_SIZE);
+            text.resize(start + input.gcount());
+            done = !input;
+            size_t found = string_view(text).substr(start).rfind('\n');
+            if (found != string_view::npos) {
+                lastNewline = start + found;
+            }
+        }
+
+        if (done) {
+            carry.clear();
+        } else {
+            carry.assign(text, lastNewline + 1, string::npos);
+            text.resize(lastNewline + 1);
+        }
+        filled.push(block);
+    }
+    filled.push(nullptr);
+}
+
+// ----------------------------------------------------------------------------
+// parseBlocks
+// Splits each block into lines, skipping empty ones as getline-based
+// processing does, and parses every line once
+// Blocks pushed to parsed in the order received, followed by nullptr
+void CommandPipeline::parseBlocks(BlockRing& filled, BlockRing& parsed) {
+    CommandBlock* block;
+    while ((block = filled.pop()) != nullptr) {
+        block->lines.clear();
+        string_view text(block->text);
+        while (!text.empty()) {
+            string_view line = TextScanner::takeLine(text);
+            if (!line.empty()) {
+                block->lines.push_back(CommandLine{line, ParsedCommand::parse(line)});
+            }
+        }
+        parsed.push(block);
+    }
+    parsed.push(nullptr);
+}
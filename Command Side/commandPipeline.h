@@ -0,0 +1,67 @@
+// -----------------------------------------------------------------------------
+// File: commandPipeline.h
+// Description: Pipelined command processing for large command files. A
+//              reader thread pulls large blocks from the input, a parser
+//              thread cuts them into lines and parses each one, and the
+//              calling thread executes the parsed lines in input order.
+//              Stages hand blocks along bounded SPSC rings and a fixed set
+//              of blocks is recycled, so reading and parsing overlap with
+//              execution without unbounded buffering.
+// Author: Sharjeel Khan
+// Assumptions: Only the executor (calling) thread touches MediaContainer
+//              and ClientManager
+//              Output is flushed once per block rather than per command
+// -----------------------------------------------------------------------------
+
+#ifndef COMMAND_PIPELINE_H
+#define COMMAND_PIPELINE_H
+
+#include "commandFactory.h"
+#include "parsedCommand.h"
+#include "spscRing.h"
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+class CommandPipeline {
+public:
+    // Creates pipeline that builds and runs commands with factory
+    CommandPipeline(const CommandFactory& factory);
+
+    // Processes every command in input, returns number that succeeded
+    int run(istream& input, MediaContainer& publications, ClientManager& clients) const;
+
+private:
+    static const size_t BLOCK_SIZE = 1 << 20;   // Bytes read per block
+    static const size_t BLOCK_COUNT = 4;        // Blocks in flight (power
+                                                // of two, sizes the rings)
+
+    // One non-empty command line and its parsed fields
+    struct CommandLine {
+        string_view text;             // Line within the block's text
+        ParsedCommand parsed;         // Fields viewing text
+    };
+
+    // Whole lines read from the input, plus their parse once parsed
+    struct CommandBlock {
+        string text;                  // Complete lines, newline terminated
+                                      // except possibly at end of input
+        vector<CommandLine> lines;    // Filled in by the parser stage
+    };
+
+    // Blocks travel between stages by pointer; nullptr marks end of input
+    using BlockRing = SpscRing<CommandBlock*, BLOCK_COUNT>;
+
+    const CommandFactory& factory;    // Builds and executes each command
+
+    // Reader stage: fills free blocks with whole lines from input
+    static void readBlocks(istream& input, BlockRing& freeBlocks, BlockRing& filled);
+
+    // Parser stage: splits filled blocks into parsed lines
+    static void parseBlocks(BlockRing& filled, BlockRing& parsed);
+};
+
+#endif // COMMAND_PIPELINE_H
@@ -29,16 +29,17 @@ DisplayCommand::~DisplayCommand() {
 // execute
 // Displays all library publications by category
 // All publications displayed in sorted order by category
-bool DisplayCommand::execute(MediaContainer& publications, ClientManager& clients) {
+bool DisplayCommand::execute(MediaContainer& publications,
+                             ClientManager& clients, OutputSink& out) {
     // Display all publication categories
     // Fiction sorted by author, then title
-    publications.displayAll('F');
+    publications.displayAll('F', out);
     
     // Children's sorted by title, then author  
-    publications.displayAll('C');
+    publications.displayAll('C', out);
     
     // Periodicals sorted by year, then month, then title
-    publications.displayAll('P');
+    publications.displayAll('P', out);
     
     return true; // Display command always succeeds
 }
@@ -47,7 +48,7 @@ bool DisplayCommand::execute(MediaContainer& publications, ClientManager& client
 // setData
 // Sets command data for display command (no data needed)
 // Command is ready for execution
-bool DisplayCommand::setData(const string& data) {
+bool DisplayCommand::setData(const ParsedCommand& command) {
     // Display command doesn't need any additional data
     // Just clear any previous error state
     errorMessage = "";
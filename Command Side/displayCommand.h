@@ -16,7 +16,7 @@
 #include "mediaContainer.h"
 #include "clientManager.h"
 
-class DisplayCommand : public Command {
+class DisplayCommand final : public Command {
 public:
    
     
@@ -28,11 +28,12 @@ public:
 
 
     // Executes display command showing all library publications
-    virtual bool execute(MediaContainer& publications, ClientManager& clients) override;
+    virtual bool execute(MediaContainer& publications, ClientManager& clients,
+                         OutputSink& out) override;
     
 
     // Sets command data (display command needs no additional data)
-    virtual bool setData(const string& data) override;
+    virtual bool setData(const ParsedCommand& command) override;
 
     // Factory method to create new DisplayCommand instance
     static Command* create();
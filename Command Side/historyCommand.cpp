@@ -11,10 +11,10 @@
 
 #include "historyCommand.h"
 #include "client.h"
-#include <sstream>
 
 // Constants
-const int INVALID_CLIENT_ID = -1;
+const ClientID INVALID_CLIENT_ID = -1;
+const int COMMAND_FIELDS = 2;  // Code and client ID
 
 // ----------------------------------------------------------------------------
 // Default Constructor
@@ -34,13 +34,15 @@ HistoryCommand::~HistoryCommand() {
 // execute
 // Displays transaction history for specified client
 // Client history displayed if client exists
-bool HistoryCommand::execute(MediaContainer& publications, ClientManager& clients) {
+bool HistoryCommand::execute(MediaContainer& publications,
+                             ClientManager& clients, OutputSink& out) {
     if (clientID == INVALID_CLIENT_ID) {
         setError("Invalid client ID for history command");
         return false;
     }
 
-    // Find the client
+    // Find the client; the guard keeps it valid for the whole command
+    ClientManager::ReadGuard guard(clients);
     Client* client = nullptr;
     if (!clients.getClient(clientID, client) || client == nullptr) {
         setError("There is no client with ID " + to_string(clientID) + ".");
@@ -48,38 +50,36 @@ bool HistoryCommand::execute(MediaContainer& publications, ClientManager& client
     }
 
     // Display client information and history header
-    cout << "Transaction history for client ";
-    client->display();
-    cout << endl;
+    out << "Transaction history for client ";
+    client->display(out);
+    out << '\n';
 
     // Display actual transaction history when implemented
     // For now, show placeholder message
-    cout << "  (No transactions recorded)" << endl;
+    out << "  (No transactions recorded)\n";
 
     return true;
 }
 
 // ----------------------------------------------------------------------------
 // setData
-// Parses command data to extract client ID
+// Takes client ID from the parsed command line
 // clientID extracted and stored
-bool HistoryCommand::setData(const string& data) {
-    istringstream iss(data);
-    char commandCode;
-    
+bool HistoryCommand::setData(const ParsedCommand& command) {
     // Parse command: H clientID
-    if (!(iss >> commandCode >> clientID)) {
+    if (command.fields < COMMAND_FIELDS) {
         setError("Invalid format for history command");
         return false;
     }
 
-    if (commandCode != 'H') {
+    if (command.code != 'H') {
         setError("Invalid command code for history command");
         return false;
     }
 
-    if (clientID < 1000 || clientID > 9999) {
-        setError("Invalid client ID: must be 4-digit number");
+    clientID = command.clientID;
+    if (clientID < MIN_CLIENT_ID) {
+        setError("Invalid client ID: must be a positive number");
         return false;
     }
 
@@ -16,7 +16,7 @@
 #include "mediaContainer.h"
 #include "clientManager.h"
 
-class HistoryCommand : public Command {
+class HistoryCommand final : public Command {
 public:
     // Creates history command object
     HistoryCommand();
@@ -26,18 +26,19 @@ public:
 
  
     // Executes history command showing client transaction history
-    virtual bool execute(MediaContainer& publications, ClientManager& clients) override;
+    virtual bool execute(MediaContainer& publications, ClientManager& clients,
+                         OutputSink& out) override;
     
 
-    // Sets command data from string format "H clientID"
-    virtual bool setData(const string& data) override;
+    // Sets command data from fields of "H clientID"
+    virtual bool setData(const ParsedCommand& command) override;
     
 
     // Factory method to create new HistoryCommand instance
     static Command* create();
 
 private:
-    int clientID;         // ID of client whose history to display
+    ClientID clientID;    // ID of client whose history to display
 };
 
 #endif // HISTORY_COMMAND_H
\ No newline at end of file
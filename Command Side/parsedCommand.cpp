@@ -0,0 +1,50 @@
+// -----------------------------------------------------------------------------
+// File: parsedCommand.cpp
+// Description: Implementation of ParsedCommand. Each field is taken from the
+//              front of the line with TextScanner, so the line is read once
+//              and nothing is allocated.
+// Author: Sharjeel Khan
+// Assumptions: Command lines hold no newline characters
+// -----------------------------------------------------------------------------
+
+#include "parsedCommand.h"
+#include "textScanner.h"
+
+// Number of fields before the publication data
+const int CODE_FIELDS = 1;
+const int CLIENT_FIELDS = 2;
+const int TYPE_FIELDS = 3;
+const int FORMAT_FIELDS = 4;
+
+// ----------------------------------------------------------------------------
+// parse
+// Reads code, client ID, publication type and format, then keeps the rest
+// of the line as publication data
+// Returns fields read; fields past the first failure are left empty
+ParsedCommand ParsedCommand::parse(string_view line) {
+    ParsedCommand command{0, '\0', 0, '\0', '\0', string_view()};
+
+    if (!TextScanner::takeChar(line, command.code)) {
+        return command;
+    }
+    command.fields = CODE_FIELDS;
+
+    if (!TextScanner::takeInt(line, command.clientID)) {
+        return command;
+    }
+    command.fields = CLIENT_FIELDS;
+
+    if (!TextScanner::takeChar(line, command.publicationType)) {
+        return command;
+    }
+    command.fields = TYPE_FIELDS;
+
+    if (!TextScanner::takeChar(line, command.formatType)) {
+        return command;
+    }
+    command.fields = FORMAT_FIELDS;
+
+    TextScanner::skipSpace(line);
+    command.publicationData = line;
+    return command;
+}
@@ -0,0 +1,36 @@
+// -----------------------------------------------------------------------------
+// File: parsedCommand.h
+// Description: Fields of one command line, sliced in a single pass. Replaces
+//              the per-command istringstream parsing: the line is scanned
+//              once with TextScanner, numbers go through from_chars, and the
+//              publication data is a view of the original line.
+// Author: Sharjeel Khan
+// Assumptions: Command line format is "code [clientID [type format data]]"
+//              The line outlives the parsed fields (and any command built
+//              from them)
+// -----------------------------------------------------------------------------
+
+#ifndef PARSED_COMMAND_H
+#define PARSED_COMMAND_H
+
+#include <cstdint>
+#include <string_view>
+
+using namespace std;
+
+struct ParsedCommand {
+    int fields;                       // Leading fields read before the first
+                                      // failure: code, id, type, format (0-4)
+    char code;                        // Command code ('C', 'R', 'H', 'D')
+    int64_t clientID;                 // Client ID, 0 if missing or malformed
+    char publicationType;             // Type of publication ('F', 'C', 'P')
+    char formatType;                  // Format type ('H' for hard copy)
+    string_view publicationData;      // Rest of line after the format,
+                                      // leading whitespace skipped
+
+    // Slices line into fields, stopping at the first field that is missing
+    // or malformed (as a chain of istream >> extractions would)
+    static ParsedCommand parse(string_view line);
+};
+
+#endif // PARSED_COMMAND_H
@@ -13,21 +13,19 @@
 
 #include "returnCommand.h"
 #include "client.h"
-#include "fiction.h"
-#include "children.h"
-#include "periodical.h"
-#include <sstream>
+#include "mediaKey.h"
 
 // Constants
-const int INVALID_CLIENT_ID = -1;
+const ClientID INVALID_CLIENT_ID = -1;
 const char VALID_FORMAT = 'H'; // Hard copy format
+const int COMMAND_FIELDS = 4;  // Code, client ID, type and format
 
 // ----------------------------------------------------------------------------
 // Default Constructor
 // Initializes return command with invalid values
 // ReturnCommand created with default state
 ReturnCommand::ReturnCommand() 
-    : clientID(INVALID_CLIENT_ID), publicationType('\0'), formatType('\0'), publicationData("") {
+    : clientID(INVALID_CLIENT_ID), publicationType('\0'), formatType('\0'), publicationData() {
 }
 
 // ----------------------------------------------------------------------------
@@ -41,14 +39,16 @@ ReturnCommand::~ReturnCommand() {
 // execute
 // Executes return command for specified client and publication
 // Publication returned if checked out, client history updated
-bool ReturnCommand::execute(MediaContainer& publications, ClientManager& clients) {
+bool ReturnCommand::execute(MediaContainer& publications,
+                            ClientManager& clients, OutputSink&) {
     // Validate client ID
     if (clientID == INVALID_CLIENT_ID) {
         setError("Invalid client ID for return command");
         return false;
     }
 
-    // Find the client
+    // Find the client; the guard keeps it valid for the whole command
+    ClientManager::ReadGuard guard(clients);
     Client* client = nullptr;
     if (!clients.getClient(clientID, client) || client == nullptr) {
         setError("There is no client with ID " + to_string(clientID) + ".");
@@ -61,62 +61,56 @@ bool ReturnCommand::execute(MediaContainer& publications, ClientManager& clients
         return false;
     }
 
-    // Create target publication for searching
-    Media* targetPub = createTargetPublication();
-    if (!targetPub) {
+    // Build lookup key for searching (views into the command line); its
+    // title also names the publication in error messages
+    MediaKey targetKey;
+    if (!createTargetKey(targetKey)) {
         setError("Invalid publication type '" + string(1, publicationType) + "'.");
         return false;
     }
 
     // Find the publication in library
-    Media* foundPub = publications.retrieve(*targetPub, publicationType);
-    delete targetPub; // Clean up search target
+    Media* foundPub = publications.retrieve(targetKey);
     
     if (!foundPub) {
-        setError(client->getFirstName() + " " + client->getLastName() + 
-                 " tried to return '" + extractTitle() + "' - not found in catalog.");
+        setError(string(client->getFirstName()) + " " + string(client->getLastName()) +
+                 " tried to return '" + string(targetKey.title) + "' - not found in catalog.");
         return false;
     }
 
     // TODO: Check if client actually has this item checked out
     // For now, we'll accept the return and increase available copies
     
-    Publication* pub = dynamic_cast<Publication*>(foundPub);
-    if (pub) {
-        pub->increaseCopies();
-        return true;
-    }
-
-    setError("Internal error: Could not process return");
-    return false;
+    foundPub->increaseCopies();
+    return true;
 }
 
 // ----------------------------------------------------------------------------
 // setData
-// Sets command data from string format "R clientID type format data"
+// Sets command data from parsed fields of "R clientID type format data"
 // All return parameters extracted and stored
-bool ReturnCommand::setData(const string& data) {
-    istringstream iss(data);
-    char commandCode;
-    
+bool ReturnCommand::setData(const ParsedCommand& command) {
     // Parse command: R clientID type format publicationData
-    if (!(iss >> commandCode >> clientID >> publicationType >> formatType)) {
+    if (command.fields < COMMAND_FIELDS) {
         setError("Invalid format for return command");
         return false;
     }
 
-    if (commandCode != 'R') {
+    if (command.code != 'R') {
         setError("Invalid command code for return command");
         return false;
     }
 
-    if (clientID < 1000 || clientID > 9999) {
-        setError("Invalid client ID: must be 4-digit number");
+    clientID = command.clientID;
+    publicationType = command.publicationType;
+    formatType = command.formatType;
+    if (clientID < MIN_CLIENT_ID) {
+        setError("Invalid client ID: must be a positive number");
         return false;
     }
 
-    // Get remaining data as publication information
-    getline(iss >> ws, publicationData);
+    // Remaining data (a view of the line) is the publication information
+    publicationData = command.publicationData;
 
     errorMessage = "";  // Clear any previous errors
     return true;
@@ -131,83 +125,11 @@ Command* ReturnCommand::create() {
 }
 
 // ----------------------------------------------------------------------------
-// createTargetPublication
-// Creates temporary publication object for searching
-// Returns new publication object or nullptr for invalid type
-Media* ReturnCommand::createTargetPublication() const {
-    Media* target = nullptr;
-    
-    switch (publicationType) {
-        case 'F':
-            target = new Fiction();
-            break;
-        case 'C':
-            target = new Children();
-            break;
-        case 'P':
-            target = new Periodical();
-            break;
-        default:
-            return nullptr;
-    }
-    
-    // Parse publication data into target object
-    // Need to convert command format to data file format
-    istringstream dataStream;
-    string convertedData;
-    
-    if (publicationType == 'P') {
-        // Command: "year month title,"
-        // Data file: "title, month year"
-        istringstream cmdStream(publicationData);
-        int year, month;
-        string title;
-        cmdStream >> year >> month;
-        getline(cmdStream >> ws, title, ',');
-        
-        convertedData = title + ", " + to_string(month) + " " + to_string(year);
-    } else if (publicationType == 'C') {
-        // Command: "title, author,"
-        // Data file: "author, title, year"
-        istringstream cmdStream(publicationData);
-        string title, author;
-        getline(cmdStream, title, ',');
-        getline(cmdStream >> ws, author, ',');
-        
-        convertedData = author + ", " + title + ", 0"; // Year doesn't matter for searching
-    } else {
-        // Fiction: command format matches data file format
-        convertedData = publicationData;
-    }
-    
-    dataStream.str(convertedData);
-    target->setData(dataStream);
-    
-    return target;
+// createTargetKey
+// Builds lookup key for searching; key fields view publicationData
+// Command formats: "author, title," (F), "title, author," (C) and
+// "year month title," (P)
+// Returns true and fills key, false for invalid publication type
+bool ReturnCommand::createTargetKey(MediaKey& key) const {
+    return MediaKey::fromCommand(publicationType, publicationData, key);
 }
-
-// ----------------------------------------------------------------------------
-// extractTitle
-// Extracts title from publication data for error messages
-// Returns title string for display
-string ReturnCommand::extractTitle() const {
-    istringstream iss(publicationData);
-    string title;
-    
-    if (publicationType == 'P') {
-        // Periodicals in commands: year month title,
-        int year, month;
-        iss >> year >> month;
-        getline(iss >> ws, title, ',');
-    } else if (publicationType == 'C') {
-        // Children's in commands: title, author,
-        getline(iss, title, ',');
-    } else {
-        // Fiction in commands: author, title,
-        string author;
-        getline(iss, author, ',');
-        getline(iss >> ws, title, ',');
-    }
-    
-    return title;
-}
\ No newline at end of file
@@ -8,6 +8,7 @@
  Assumptions: MediaContainer can retrieve publications by type and data
               ClientManager can find clients by ID
               Command data format is "R clientID type format publicationData"
+              Command line outlives the command (data is a view of it)
 -----------------------------------------------------------------------------
 */
 
@@ -18,7 +19,7 @@
 #include "mediaContainer.h"
 #include "clientManager.h"
 
-class ReturnCommand : public Command {
+class ReturnCommand final : public Command {
 public:
     // Creates return command object
     ReturnCommand();
@@ -28,26 +29,25 @@ public:
 
    
     // Executes return command for specified client and publication
-    virtual bool execute(MediaContainer& publications, ClientManager& clients) override;
+    virtual bool execute(MediaContainer& publications, ClientManager& clients,
+                         OutputSink& out) override;
 
-    // Sets command data from string format "R clientID type format data"
-    virtual bool setData(const string& data) override;
+    // Sets command data from fields of "R clientID type format data"
+    virtual bool setData(const ParsedCommand& command) override;
     
     // Factory method to create new ReturnCommand instance
     static Command* create();
 
 private:
-    int clientID;                     // ID of client returning publication
+    ClientID clientID;                // ID of client returning publication
     char publicationType;             // Type of publication ('F', 'C', 'P')
     char formatType;                  // Format type ('H' for hard copy)
-    string publicationData;           // Publication identification data
+    string_view publicationData;      // Publication identification data,
+                                      // viewing the command line
 
  
-    // Creates temporary publication object for searching
-    Media* createTargetPublication() const;
-    
-    // Extracts title from publication data for error messages
-    string extractTitle() const;
+    // Builds catalog lookup key from publicationData without allocating
+    bool createTargetKey(MediaKey& key) const;
 };
 
 #endif // RETURN_COMMAND_H
\ No newline at end of file
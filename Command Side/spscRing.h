@@ -0,0 +1,82 @@
+// -----------------------------------------------------------------------------
+// File: spscRing.h
+// Description: Bounded single-producer/single-consumer ring buffer. One
+//              thread pushes and one thread pops; head and tail live on
+//              separate cache lines and are the only shared state, so a
+//              hand-off costs two atomic operations and no locks.
+// Author: Sharjeel Khan
+// Assumptions: Exactly one producer thread and one consumer thread
+//              CAPACITY is a power of two
+//              Blocked push/pop yield the CPU while waiting
+// -----------------------------------------------------------------------------
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+using namespace std;
+
+template <typename T, size_t CAPACITY>
+class SpscRing {
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0,
+                  "SpscRing capacity must be a power of two");
+
+public:
+    // Creates an empty ring
+    SpscRing() : head(0), tail(0) {}
+
+    // Producer: appends item, returns false if the ring is full
+    bool tryPush(const T& item) {
+        size_t back = tail.load(memory_order_relaxed);
+        if (back - head.load(memory_order_acquire) == CAPACITY) {
+            return false;
+        }
+        slots[back & MASK] = item;
+        tail.store(back + 1, memory_order_release);
+        return true;
+    }
+
+    // Consumer: removes oldest item into item, returns false if empty
+    bool tryPop(T& item) {
+        size_t front = head.load(memory_order_relaxed);
+        if (front == tail.load(memory_order_acquire)) {
+            return false;
+        }
+        item = slots[front & MASK];
+        head.store(front + 1, memory_order_release);
+        return true;
+    }
+
+    // Producer: appends item, waiting while the ring is full
+    void push(const T& item) {
+        while (!tryPush(item)) {
+            this_thread::yield();
+        }
+    }
+
+    // Consumer: removes and returns oldest item, waiting while empty
+    T pop() {
+        T item;
+        while (!tryPop(item)) {
+            this_thread::yield();
+        }
+        return item;
+    }
+
+private:
+    static const size_t MASK = CAPACITY - 1;
+    static const size_t CACHE_LINE = 64;
+
+    alignas(CACHE_LINE) atomic<size_t> head;    // Next slot to pop
+    alignas(CACHE_LINE) atomic<size_t> tail;    // Next slot to push
+    alignas(CACHE_LINE) T slots[CAPACITY];      // Items in flight
+
+    // Rings are shared between threads by reference, copying is not supported
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+};
+
+#endif // SPSC_RING_H
@@ -0,0 +1,319 @@
+/*
+ -----------------------------------------------------------------------------
+ File: compressedReader.cpp
+ Description: Implementation of CompressedReader. The worker thread pulls
+              empty blocks from freeBlocks, fills them with decoded bytes
+              and pushes them to filled; underflow hands each block to the
+              stream and returns the previous one.
+ Author: Sharjeel Khan
+ Assumptions: Input larger than 4GB is fed to zlib in slices, since its
+              counters are 32 bits wide
+ -----------------------------------------------------------------------------
+*/
+
+#include "compressedReader.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <zlib.h>
+#ifdef SSSS_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+using namespace std;
+
+// Constants
+const unsigned char GZIP_MAGIC[] = {0x1f, 0x8b};
+const unsigned char ZSTD_MAGIC[] = {0x28, 0xb5, 0x2f, 0xfd};
+const int GZIP_WINDOW_BITS = 16 + MAX_WBITS;    // Expect a gzip header
+const size_t MAX_INFLATE_INPUT = 1u << 30;      // Slice fed to zlib at once
+
+// ----------------------------------------------------------------------------
+// Default Constructor
+// Initializes closed reader with an empty get area
+CompressedReader::CompressedReader()
+    : format(NO_COMPRESSION), current(nullptr), finished(true),
+      stopping(false), failed(false) {
+    setg(nullptr, nullptr, nullptr);
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Stops the worker before the blocks it writes to go away
+CompressedReader::~CompressedReader() {
+    close();
+}
+
+// ----------------------------------------------------------------------------
+// detectFormat
+// Compares leading bytes against the gzip and zstd magic numbers
+// Returns detected format, NO_COMPRESSION if neither matches
+CompressionFormat CompressedReader::detectFormat(string_view data) {
+    if (data.size() >= sizeof(GZIP_MAGIC) &&
+        memcmp(data.data(), GZIP_MAGIC, sizeof(GZIP_MAGIC)) == 0) {
+        return GZIP_COMPRESSION;
+    }
+    if (data.size() >= sizeof(ZSTD_MAGIC) &&
+        memcmp(data.data(), ZSTD_MAGIC, sizeof(ZSTD_MAGIC)) == 0) {
+        return ZSTD_COMPRESSION;
+    }
+    return NO_COMPRESSION;
+}
+
+// ----------------------------------------------------------------------------
+// open
+// Maps the file; plain files become the get area directly, compressed
+// files get a decompressor thread feeding blocks
+// Returns true if the file is readable in this build
+bool CompressedReader::open(const string& path) {
+    close();
+    if (!source.open(path)) {
+        return false;
+    }
+
+    string_view contents = source.getContents();
+    format = detectFormat(contents);
+#ifndef SSSS_HAVE_ZSTD
+    if (format == ZSTD_COMPRESSION) {
+        cout << "ERROR: " << path << " is zstd compressed, which this build does not support." << endl;
+        source.close();
+        return false;
+    }
+#endif
+
+    failed = false;
+    stopping = false;
+    if (format == NO_COMPRESSION) {
+        char* start = const_cast<char*>(contents.data());   // Get area is never written
+        setg(start, start, start + contents.size());
+        finished = true;
+        return true;
+    }
+
+    for (size_t i = 0; i < BLOCK_COUNT; ++i) {
+        blocks[i].bytes.resize(BLOCK_SIZE);
+        freeBlocks.push(&blocks[i]);
+    }
+    setg(nullptr, nullptr, nullptr);
+    finished = false;
+    worker = thread(&CompressedReader::decompress, this);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// close
+// Tells the worker to quit, waits for it, and empties both rings so the
+// reader can be opened again
+void CompressedReader::close() {
+    stopping = true;
+    if (worker.joinable()) {
+        worker.join();
+    }
+    Block* block;
+    while (filled.tryPop(block)) {
+    }
+    while (freeBlocks.tryPop(block)) {
+    }
+    current = nullptr;
+    finished = true;
+    setg(nullptr, nullptr, nullptr);
+    source.close();
+}
+
+// ----------------------------------------------------------------------------
+// hasFailed
+// Returns true if the decoder rejected the input
+bool CompressedReader::hasFailed() const {
+    return failed;
+}
+
+// ----------------------------------------------------------------------------
+// getContents
+// Plain files return the rest of the mapping without copying; compressed
+// files append each decoded block to storage as it arrives
+// Returns view of the remaining bytes
+string_view CompressedReader::getContents(string& storage) {
+    if (format == NO_COMPRESSION) {
+        string_view rest(gptr(), egptr() - gptr());
+        setg(egptr(), egptr(), egptr());
+        return rest;
+    }
+    storage.clear();
+    while (underflow() != traits_type::eof()) {
+        storage.append(gptr(), egptr() - gptr());
+        setg(egptr(), egptr(), egptr());
+    }
+    return storage;
+}
+
+// ----------------------------------------------------------------------------
+// underflow
+// Returns the consumed block to the worker and takes the next one
+// Returns next character, or eof at end of stream
+CompressedReader::int_type CompressedReader::underflow() {
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+    if (finished) {
+        return traits_type::eof();
+    }
+    if (current != nullptr) {
+        freeBlocks.push(current);
+        current = nullptr;
+    }
+
+    Block* block = filled.pop();
+    if (block == nullptr) {
+        finished = true;
+        setg(nullptr, nullptr, nullptr);
+        return traits_type::eof();
+    }
+    current = block;
+    setg(block->bytes.data(), block->bytes.data(), block->bytes.data() + block->size);
+    return traits_type::to_int_type(*gptr());
+}
+
+// ----------------------------------------------------------------------------
+// decompress
+// Worker thread body; nullptr is always published last unless stopping
+void CompressedReader::decompress() {
+    bool ok = format == GZIP_COMPRESSION ? inflateGzip() : decompressZstd();
+    if (!ok) {
+        failed = true;
+    }
+    publish(nullptr);
+}
+
+// ----------------------------------------------------------------------------
+// inflateGzip
+// Streams the mapped input through zlib, publishing each full block.
+// A finished member followed by more input starts the next member
+// Returns false on corrupt or truncated data
+bool CompressedReader::inflateGzip() {
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if (inflateInit2(&stream, GZIP_WINDOW_BITS) != Z_OK) {
+        return false;
+    }
+
+    string_view input = source.getContents();
+    Block* block = takeFreeBlock();
+    bool ok = true;
+    while (block != nullptr) {
+        if (block->size == BLOCK_SIZE) {
+            if (!publish(block)) {
+                block = nullptr;
+                break;
+            }
+            block = takeFreeBlock();
+            continue;
+        }
+        if (stream.avail_in == 0 && !input.empty()) {
+            size_t slice = min(input.size(), MAX_INFLATE_INPUT);
+            stream.next_in = (Bytef*)input.data();
+            stream.avail_in = (uInt)slice;
+            input.remove_prefix(slice);
+        }
+
+        stream.next_out = (Bytef*)block->bytes.data() + block->size;
+        stream.avail_out = (uInt)(BLOCK_SIZE - block->size);
+        int result = inflate(&stream, Z_NO_FLUSH);
+        block->size = BLOCK_SIZE - stream.avail_out;
+        if (result == Z_STREAM_END) {
+            if (stream.avail_in == 0 && input.empty()) {
+                break;                // Last member complete
+            }
+            inflateReset(&stream);
+        } else if (result != Z_OK) {
+            ok = false;               // Corrupt, or input ended inside a
+            break;                    // member (no progress possible)
+        }
+    }
+
+    if (block != nullptr && block->size > 0) {
+        publish(block);
+    }
+    inflateEnd(&stream);
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// decompressZstd
+// Streams the mapped input through the zstd decoder, publishing each full
+// block; stops once all input is consumed and the decoder has no more
+// output to give
+// Returns false on corrupt or truncated data, or without zstd support
+bool CompressedReader::decompressZstd() {
+#ifdef SSSS_HAVE_ZSTD
+    ZSTD_DStream* stream = ZSTD_createDStream();
+    if (stream == nullptr) {
+        return false;
+    }
+    ZSTD_initDStream(stream);
+
+    string_view contents = source.getContents();
+    ZSTD_inBuffer input = {contents.data(), contents.size(), 0};
+    Block* block = takeFreeBlock();
+    bool ok = true;
+    while (block != nullptr) {
+        if (block->size == BLOCK_SIZE) {
+            if (!publish(block)) {
+                block = nullptr;
+                break;
+            }
+            block = takeFreeBlock();
+            continue;
+        }
+
+        ZSTD_outBuffer output = {block->bytes.data() + block->size, BLOCK_SIZE - block->size, 0};
+        size_t result = ZSTD_decompressStream(stream, &output, &input);
+        if (ZSTD_isError(result)) {
+            ok = false;
+            break;
+        }
+        block->size += output.pos;
+        if (input.pos == input.size && output.pos < output.size) {
+            ok = result == 0;         // Nonzero: input ended inside a frame
+            break;
+        }
+    }
+
+    if (block != nullptr && block->size > 0) {
+        publish(block);
+    }
+    ZSTD_freeDStream(stream);
+    return ok;
+#else
+    return false;
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// takeFreeBlock
+// Waits for the reader to return a block
+// Returns emptied block, nullptr if the reader is closing
+CompressedReader::Block* CompressedReader::takeFreeBlock() {
+    Block* block;
+    while (!freeBlocks.tryPop(block)) {
+        if (stopping) {
+            return nullptr;
+        }
+        this_thread::yield();
+    }
+    block->size = 0;
+    return block;
+}
+
+// ----------------------------------------------------------------------------
+// publish
+// Waits for room in the filled ring
+// Returns false if the reader is closing
+bool CompressedReader::publish(Block* block) {
+    while (!filled.tryPush(block)) {
+        if (stopping) {
+            return false;
+        }
+        this_thread::yield();
+    }
+    return true;
+}
@@ -0,0 +1,110 @@
+/*
+ -----------------------------------------------------------------------------
+ File: compressedReader.h
+ Description: Input buffer for data and command files that may be stored
+              compressed. The file is memory-mapped and its format detected
+              from the leading magic bytes. Plain files are served straight
+              from the mapping; gzip (and zstd when built with it) files
+              are decompressed on a background thread into large blocks
+              handed over through an SPSC ring, so decompression overlaps
+              with parsing and nothing is written to disk.
+ Author: Sharjeel Khan
+ Assumptions: Link with -lz; zstd needs SSSS_HAVE_ZSTD defined and -lzstd
+              One thread reads from the buffer
+              Concatenated gzip members are read as one stream
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef COMPRESSEDREADER_H
+#define COMPRESSEDREADER_H
+
+#include "mappedFile.h"
+#include "spscRing.h"
+#include <atomic>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Storage format of a file, detected from its first bytes
+enum CompressionFormat {
+    NO_COMPRESSION,                   // Plain text
+    GZIP_COMPRESSION,                 // gzip (RFC 1952)
+    ZSTD_COMPRESSION                  // Zstandard frame
+};
+
+class CompressedReader : public streambuf {
+public:
+    // Creates closed reader
+    CompressedReader();
+
+    // Stops decompression and unmaps the file
+    ~CompressedReader();
+
+    // Returns format identified by the magic bytes at the start of data
+    static CompressionFormat detectFormat(string_view data);
+
+    // Maps path and starts decompressing it if needed
+    // Returns false if the file cannot be opened or its format is not
+    // supported by this build
+    bool open(const string& path);
+
+    // Stops decompression and unmaps the file
+    void close();
+
+    // Returns true if the compressed data was corrupt or truncated; the
+    // stream ends early when this happens
+    bool hasFailed() const;
+
+    // Returns all unread bytes: a view of the mapping for plain files,
+    // otherwise decompressed into storage. Valid while the reader is open
+    // (and storage lives)
+    string_view getContents(string& storage);
+
+protected:
+    // Refills the get area with the next decompressed block
+    virtual int_type underflow() override;
+
+private:
+    static const size_t BLOCK_SIZE = 1 << 20;   // Decompressed bytes per block
+    static const size_t BLOCK_COUNT = 4;        // Blocks in flight
+
+    struct Block {
+        vector<char> bytes;           // BLOCK_SIZE bytes of storage
+        size_t size;                  // Bytes holding output
+    };
+
+    // Blocks travel between threads by pointer; nullptr ends the stream
+    using BlockRing = SpscRing<Block*, BLOCK_COUNT>;
+
+    MappedFile source;                // Mapped file (compressed or not)
+    CompressionFormat format;         // Format of source
+    Block blocks[BLOCK_COUNT];        // Fixed pool cycled between threads
+    BlockRing freeBlocks;             // Reader -> decompressor
+    BlockRing filled;                 // Decompressor -> reader
+    Block* current;                   // Block in the get area, if any
+    bool finished;                    // End of stream reached
+    thread worker;                    // Decompressor thread
+    atomic<bool> stopping;            // Reader asked the worker to quit
+    atomic<bool> failed;              // Decompression error seen
+
+    // Worker entry: runs the decoder for format, then ends the stream
+    void decompress();
+
+    // Decoders: write source into blocks, return false on bad input
+    bool inflateGzip();
+    bool decompressZstd();
+
+    // Worker side of the rings; return nullptr/false once stopping
+    Block* takeFreeBlock();
+    bool publish(Block* block);
+
+    // Readers own a thread and a mapping, copying is not supported
+    CompressedReader(const CompressedReader&) = delete;
+    CompressedReader& operator=(const CompressedReader&) = delete;
+};
+
+#endif // COMPRESSEDREADER_H
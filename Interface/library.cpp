@@ -11,8 +11,14 @@
 */
 
 #include "library.h"
-#include <sstream>
+#include "snapshot.h"
+#include "textScanner.h"
+#include <cstring>
+#include <functional>
 #include <iomanip>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 // Constants
 const int INITIAL_COUNT = 0;
@@ -20,7 +26,15 @@ const int INITIAL_COUNT = 0;
 // ----------------------------------------------------------------------------
 // Default Constructor
 // Initializes empty library system with all subsystems
-Library::Library() : initialized(false) {
+Library::Library(CatalogBackend backend, bool useArena, int loadThreads)
+    : publications(backend, useArena), initialized(false), loadThreads(loadThreads),
+      pipelinedCommands(false) {
+    if (this->loadThreads < 1) {
+        this->loadThreads = (int)thread::hardware_concurrency();
+        if (this->loadThreads < 1) {
+            this->loadThreads = 1;
+        }
+    }
     resetStatistics();
 }
 
@@ -72,17 +86,22 @@ int Library::processCommands(const string& commandFile) {
         return 0;
     }
 
-    ifstream commandStream(commandFile);
-    if (!commandStream.is_open()) {
+    // Plain, gzip or zstd file; compressed input is decoded on a
+    // background thread as the commands are read
+    CompressedReader reader;
+    if (!reader.open(commandFile)) {
         cout << "ERROR: Cannot open command file: " << commandFile << endl;
         return 0;
     }
+    istream commandStream(&reader);
 
     cout << "\nProcessing commands from: " << commandFile << endl;
     cout << "==========================================" << endl;
 
     int commandsProcessed = processCommandsFromStream(commandStream);
-    commandStream.close();
+    if (reader.hasFailed()) {
+        cout << "ERROR: Compressed file is corrupt or truncated: " << commandFile << endl;
+    }
 
     totalCommandsProcessed += commandsProcessed;
     return commandsProcessed;
@@ -96,6 +115,9 @@ int Library::processCommandsFromStream(istream& input) {
         cout << "ERROR: Library not properly initialized." << endl;
         return 0;
     }
+    if (pipelinedCommands) {
+        return CommandPipeline(factory).run(input, publications, clients);
+    }
     return factory.processCommands(input, publications, clients);
 }
 
@@ -108,18 +130,20 @@ void Library::displayLibrary() const {
         return;
     }
 
-    cout << "\n" << string(60, '=') << endl;
-    cout << "SHHH LIBRARY COMPLETE CATALOG" << endl;
-    cout << string(60, '=') << endl;
+    OutputSink out(cout);
+    out << '\n';
+    out.fill('=', 60) << '\n';
+    out << "SHHH LIBRARY COMPLETE CATALOG\n";
+    out.fill('=', 60) << '\n';
 
-    publications.displayAll('F');
-    publications.displayAll('C');
-    publications.displayAll('P');
+    publications.displayAll('F', out);
+    publications.displayAll('C', out);
+    publications.displayAll('P', out);
 }
 
 // ----------------------------------------------------------------------------
 // DisplayClients
-// Shows all registered library clients
+// Shows all registered library clients ordered by last, then first name
 
 void Library::displayClients() const {
     if (!initialized) {
@@ -127,10 +151,39 @@ void Library::displayClients() const {
         return;
     }
 
-    cout << "\n" << string(40, '=') << endl;
-    cout << "SHHH LIBRARY REGISTERED CLIENTS" << endl;
-    cout << string(40, '=') << endl;
-    clients.displayAll();
+    OutputSink out(cout);
+    out << '\n';
+    out.fill('=', 40) << '\n';
+    out << "SHHH LIBRARY REGISTERED CLIENTS\n";
+    out.fill('=', 40) << '\n';
+    clients.displaySorted(out);
+}
+
+// ----------------------------------------------------------------------------
+// displayClientsByName
+// Looks up clients by last name prefix through the client name index
+// Matching clients displayed in name order
+void Library::displayClientsByName(const string& prefix) const {
+    if (!initialized) {
+        cout << "ERROR: Library not initialized." << endl;
+        return;
+    }
+
+    string_view lastNamePrefix(prefix);
+    if (!lastNamePrefix.empty() && lastNamePrefix.back() == '*') {
+        lastNamePrefix.remove_suffix(1);
+    }
+    vector<Client> found;
+    clients.findByLastNamePrefix(lastNamePrefix, found);
+
+    OutputSink out(cout);
+    out << "\nClients with last name " << lastNamePrefix << "*:\n";
+    for (const Client& client : found) {
+        client.display(out);
+    }
+    if (found.empty()) {
+        out << "No matching clients.\n";
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -141,15 +194,253 @@ void Library::displayStatistics() const {
         cout << "ERROR: Library not initialized." << endl;
         return;
     }
-    cout << "\n" << string(50, '=') << endl;
-    cout << "SHHH LIBRARY SYSTEM STATISTICS" << endl;
-    cout << string(50, '=') << endl;
-    cout << "Total Publications: " << totalPublications << endl;
-    cout << "Total Clients: " << totalClients << endl;
-    cout << "Commands Processed This Session: " << totalCommandsProcessed << endl;
+    OutputSink out(cout);
+    out << '\n';
+    out.fill('=', 50) << '\n';
+    out << "SHHH LIBRARY SYSTEM STATISTICS\n";
+    out.fill('=', 50) << '\n';
+    out << "Total Publications: " << totalPublications << '\n';
+    out << "Total Clients: " << totalClients << '\n';
+    out << "Commands Processed This Session: " << totalCommandsProcessed << '\n';
     
-    cout << "\nClient Management Statistics:" << endl;
-    clients.displayStats();
+    out << "\nClient Management Statistics:\n";
+    clients.displayStats(out);
+
+    out << "\nPublication String Statistics:\n";
+    publications.getStringPool()->displayStats(out);
+}
+
+// ----------------------------------------------------------------------------
+// saveSnapshot
+// Writes header, string table, publication table, client table and blob.
+// Distinct strings are stored once; records refer to them by index
+// Returns true if the whole file was written
+bool Library::saveSnapshot(const string& filename) const {
+    if (!initialized) {
+        cout << "ERROR: Library not initialized." << endl;
+        return false;
+    }
+
+    vector<Media*> items;
+    vector<Client*> members;
+    publications.collectAll(items);
+    clients.collectAll(members);
+
+    // Assign each distinct string an index and a place in the blob
+    vector<SnapshotString> strings;
+    unordered_map<string_view, uint32_t> stringIndex;
+    string blob;
+    auto indexOf = [&](string_view text) -> uint32_t {
+        if (text.empty()) {
+            return SNAPSHOT_NO_STRING;
+        }
+        auto found = stringIndex.find(text);
+        if (found != stringIndex.end()) {
+            return found->second;
+        }
+        uint32_t index = (uint32_t)strings.size();
+        strings.push_back(SnapshotString{blob.size(), (uint32_t)text.size(), 0});
+        blob.append(text.data(), text.size());
+        stringIndex.emplace(string_view(text), index);
+        return index;
+    };
+
+    vector<SnapshotPublication> publicationTable;
+    publicationTable.reserve(items.size());
+    for (const Media* item : items) {
+        MediaRecord fields = item->getRecord();
+        SnapshotPublication record = {};
+        record.author = indexOf(fields.author);
+        record.title = indexOf(fields.title);
+        record.year = fields.year;
+        record.month = fields.month;
+        record.copies = item->getCopies();
+        record.type = fields.type;
+        publicationTable.push_back(record);
+    }
+
+    // Client names view the name pool, so the string index can key on them
+    vector<SnapshotClient> clientTable;
+    clientTable.reserve(members.size());
+    for (const Client* member : members) {
+        SnapshotClient record = {};
+        record.id = member->getID();
+        record.firstName = indexOf(member->getFirstName());
+        record.lastName = indexOf(member->getLastName());
+        clientTable.push_back(record);
+    }
+
+    // Lay out sections, each aligned for direct access from the mapping
+    auto align = [](uint64_t offset) {
+        return (offset + SNAPSHOT_ALIGNMENT - 1) & ~(SNAPSHOT_ALIGNMENT - 1);
+    };
+    SnapshotHeader header = {};
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byteOrder = SNAPSHOT_BYTE_ORDER;
+    header.stringCount = strings.size();
+    header.publicationCount = publicationTable.size();
+    header.clientCount = clientTable.size();
+    header.stringOffset = align(sizeof(SnapshotHeader));
+    header.publicationOffset = align(header.stringOffset + strings.size() * sizeof(SnapshotString));
+    header.clientOffset = align(header.publicationOffset +
+                                publicationTable.size() * sizeof(SnapshotPublication));
+    header.blobOffset = align(header.clientOffset + clientTable.size() * sizeof(SnapshotClient));
+    header.blobSize = blob.size();
+    header.totalPublications = totalPublications;
+    header.totalClients = totalClients;
+    header.totalCommandsProcessed = totalCommandsProcessed;
+
+    ofstream file(filename, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        cout << "ERROR: Cannot create snapshot file: " << filename << endl;
+        return false;
+    }
+    auto writeAt = [&file](uint64_t offset, const void* data, size_t bytes) {
+        static const char padding[SNAPSHOT_ALIGNMENT] = {};
+        file.write(padding, offset - (uint64_t)file.tellp());   // Under alignment
+        file.write(static_cast<const char*>(data), bytes);
+    };
+    writeAt(0, &header, sizeof(header));
+    writeAt(header.stringOffset, strings.data(), strings.size() * sizeof(SnapshotString));
+    writeAt(header.publicationOffset, publicationTable.data(),
+            publicationTable.size() * sizeof(SnapshotPublication));
+    writeAt(header.clientOffset, clientTable.data(), clientTable.size() * sizeof(SnapshotClient));
+    writeAt(header.blobOffset, blob.data(), blob.size());
+
+    if (!file) {
+        cout << "ERROR: Failed writing snapshot file: " << filename << endl;
+        return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// loadSnapshot
+// Maps snapshot, validates every table against the file size, pools the
+// strings in place, then rebuilds catalog (already in sorted order, so
+// bulkLoad builds trees directly) and client table
+// Returns true if library restored; library must not be initialized
+bool Library::loadSnapshot(const string& filename) {
+    if (initialized) {
+        cout << "ERROR: Snapshot can only be loaded into an empty library." << endl;
+        return false;
+    }
+    if (!snapshot.open(filename)) {
+        cout << "ERROR: Cannot open snapshot file: " << filename << endl;
+        return false;
+    }
+
+    string_view contents = snapshot.getContents();
+    const char* base = contents.data();
+    uint64_t fileSize = contents.size();
+    SnapshotHeader header;
+    if (fileSize < sizeof(header)) {
+        cout << "ERROR: Snapshot file is truncated: " << filename << endl;
+        snapshot.close();
+        return false;
+    }
+    memcpy(&header, base, sizeof(header));
+    if (memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0 ||
+        header.byteOrder != SNAPSHOT_BYTE_ORDER) {
+        cout << "ERROR: Not a library snapshot: " << filename << endl;
+        snapshot.close();
+        return false;
+    }
+    if (header.version != SNAPSHOT_VERSION) {
+        cout << "ERROR: Unsupported snapshot version " << header.version << endl;
+        snapshot.close();
+        return false;
+    }
+
+    // Every table must lie inside the file
+    auto fits = [fileSize](uint64_t offset, uint64_t count, uint64_t size) {
+        return offset <= fileSize && count <= (fileSize - offset) / size;
+    };
+    if (!fits(header.stringOffset, header.stringCount, sizeof(SnapshotString)) ||
+        !fits(header.publicationOffset, header.publicationCount, sizeof(SnapshotPublication)) ||
+        !fits(header.clientOffset, header.clientCount, sizeof(SnapshotClient)) ||
+        !fits(header.blobOffset, header.blobSize, 1)) {
+        cout << "ERROR: Snapshot file is truncated: " << filename << endl;
+        snapshot.close();
+        return false;
+    }
+
+    // Check every string lies in the blob before pooling any of them, so a
+    // rejected snapshot leaves no views into the unmapped file
+    const char* blob = base + header.blobOffset;
+    vector<string_view> strings(header.stringCount);
+    for (uint64_t i = 0; i < header.stringCount; ++i) {
+        SnapshotString entry;
+        memcpy(&entry, base + header.stringOffset + i * sizeof(SnapshotString), sizeof(entry));
+        if (entry.offset > header.blobSize || entry.length > header.blobSize - entry.offset) {
+            cout << "ERROR: Snapshot string table is corrupt: " << filename << endl;
+            snapshot.close();
+            return false;
+        }
+        strings[i] = string_view(blob + entry.offset, entry.length);
+    }
+
+    // Pool the strings publications reference in place in the mapping, each
+    // on first use; client names are copied into ClientNamePool instead, so
+    // they are read straight from strings and never enter the pool
+    StringPool* pool = publications.getStringPool();
+    vector<bool> pooled(strings.size(), false);
+    auto stringAt = [&strings](uint32_t index) {
+        return index < strings.size() ? strings[index] : string_view();
+    };
+    auto pooledStringAt = [&strings, &pooled, pool](uint32_t index) {
+        if (index >= strings.size()) {
+            return string_view();
+        }
+        if (!pooled[index]) {
+            strings[index] = pool->adopt(strings[index]);
+            pooled[index] = true;
+        }
+        return strings[index];
+    };
+
+    // Rebuild publications with their saved copy counts
+    vector<Media*> parsed;
+    parsed.reserve(header.publicationCount);
+    for (uint64_t i = 0; i < header.publicationCount; ++i) {
+        SnapshotPublication entry;
+        memcpy(&entry, base + header.publicationOffset + i * sizeof(SnapshotPublication),
+               sizeof(entry));
+        MediaRecord record{entry.type, pooledStringAt(entry.author),
+                           pooledStringAt(entry.title), entry.month, entry.year};
+        Arena* arena = publications.getArena(entry.type);
+        Media* publication = pubFactory.createPublication(entry.type, arena, pool);
+        if (publication) {
+            publication->setData(record);
+            publication->setCopies(entry.copies);
+            parsed.push_back(publication);
+        }
+    }
+    vector<Media*> rejected;
+    publications.bulkLoad(parsed, rejected);
+    for (Media* publication : rejected) {
+        pubFactory.destroyPublication(publication, publications.getArena(publication->getType()));
+    }
+
+    // Insert clients last to first: ChainedClientStorage links each new
+    // client at the head of its chain, so its chains keep their saved order.
+    // The other storages keep no saved order, so direction does not matter
+    for (uint64_t i = header.clientCount; i > 0; --i) {
+        SnapshotClient entry;
+        memcpy(&entry, base + header.clientOffset + (i - 1) * sizeof(SnapshotClient),
+               sizeof(entry));
+        Client* client = new Client(entry.id, stringAt(entry.firstName), stringAt(entry.lastName));
+        if (!clients.insert(client)) {
+            delete client;
+        }
+    }
+
+    totalPublications = header.totalPublications;
+    totalClients = header.totalClients;
+    totalCommandsProcessed = header.totalCommandsProcessed;
+    initialized = true;
+    return true;
 }
 
 // ----------------------------------------------------------------------------
@@ -159,72 +450,114 @@ bool Library::isInitialized() const {
     return initialized;
 }
 
+// ----------------------------------------------------------------------------
+// setPipelinedCommands
+// Chooses between the sequential and pipelined command loops
+void Library::setPipelinedCommands(bool pipelined) {
+    pipelinedCommands = pipelined;
+}
+
 // ----------------------------------------------------------------------------
 // loadPublications
-// Loads publication data from file using PublicationFactory
+// Loads publication data from memory-mapped (or decompressed) file using
+// PublicationFactory. Lines are parsed on loadThreads threads, then built
+// and merged serially
 int Library::loadPublications(const string& filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+    CompressedReader file;
+    string inflated;
+    if (!file.open(filename)) {
         cout << "ERROR: Cannot open publication file: " << filename << endl;
         return 0;
     }
-    int publicationsLoaded = 0;
-    string line;
-
-    while (getline(file, line)) {
-        if (line.empty()) continue;
+    string_view contents = file.getContents(inflated);
+    if (file.hasFailed()) {
+        cout << "ERROR: Compressed file is corrupt or truncated: " << filename << endl;
+    }
 
-        char publicationType = line[0];
-        string publicationData = line.substr(2); // Skip type and space
+    // Parse chunks of the file in parallel; records only view the contents
+    vector<string_view> chunks = TextScanner::splitChunks(contents, loadThreads);
+    vector<vector<MediaRecord>> records(chunks.size());
+    vector<thread> workers;
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        workers.emplace_back(parsePublications, chunks[i], ref(records[i]));
+    }
+    if (!chunks.empty()) {
+        parsePublications(chunks[0], records[0]);
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
 
-        // Create publication using factory
-        Media* publication = pubFactory.createPublication(publicationType);
-        if (publication) {
-            // Parse publication data
-            istringstream dataStream(publicationData);
-            publication->setData(dataStream);
-
-            // Insert into library
-            if (publications.insert(publication)) {
-                publicationsLoaded++;
-            } else {
-                // Insert failed (duplicate), clean up
-                delete publication;
+    // Create publications in file order, so error messages and duplicate
+    // handling match a single-threaded load
+    vector<Media*> parsed;
+    for (const vector<MediaRecord>& chunk : records) {
+        for (const MediaRecord& record : chunk) {
+            // Create publication using factory, in the tree's arena if it has
+            // one and with strings interned in the catalog's pool
+            Arena* arena = publications.getArena(record.type);
+            Media* publication = pubFactory.createPublication(record.type, arena,
+                                                              publications.getStringPool());
+            if (publication) {
+                publication->setData(record);
+                parsed.push_back(publication);
             }
         }
     }
 
-    file.close();
+    // Build the catalog in one pass, then clean up rejected duplicates
+    vector<Media*> rejected;
+    int publicationsLoaded = publications.bulkLoad(parsed, rejected);
+    for (Media* publication : rejected) {
+        pubFactory.destroyPublication(publication, publications.getArena(publication->getType()));
+    }
+
     return publicationsLoaded;
 }
 
+// ----------------------------------------------------------------------------
+// parsePublications
+// Parses each non-empty line of chunk into a record
+// Records appended in line order
+void Library::parsePublications(string_view chunk, vector<MediaRecord>& records) {
+    while (!chunk.empty()) {
+        string_view line = TextScanner::takeLine(chunk);
+        if (line.empty()) continue;
+        records.push_back(MediaRecord::fromLine(line));
+    }
+}
+
 // ----------------------------------------------------------------------------
 // loadClients
-// Loads client data from file using ClientManager
+// Loads client data from file (plain or compressed) using ClientManager
 int Library::loadClients(const string& filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+    CompressedReader file;
+    string inflated;
+    if (!file.open(filename)) {
         cout << "ERROR: Cannot open client file: " << filename << endl;
         return 0;
     }
-    int clientsLoaded = clients.readClientsFromStream(file);
-    file.close();
-    return clientsLoaded;
+    string_view contents = file.getContents(inflated);
+    if (file.hasFailed()) {
+        cout << "ERROR: Compressed file is corrupt or truncated: " << filename << endl;
+    }
+    return clients.readClientsFromBuffer(contents, loadThreads);
 }
 
 // ----------------------------------------------------------------------------
 // displayWelcome
 // Shows welcome message and basic library information
 void Library::displayWelcome() const {
-    cout << string(60, '=') << endl;
-    cout << "  WELCOME TO SHHH LIBRARY MANAGEMENT SYSTEM" << endl;
-    cout << "  (Stocking Hardy Harmonious Hard copies)" << endl;
-    cout << string(60, '=') << endl;
-    cout << "Library successfully initialized!" << endl;
-    cout << "Publications loaded: " << totalPublications << endl;
-    cout << "Clients registered: " << totalClients << endl;
-    cout << "System ready for command processing." << endl;
-    cout << string(60, '=') << endl << endl;
+    OutputSink out(cout);
+    out.fill('=', 60) << '\n';
+    out << "  WELCOME TO SHHH LIBRARY MANAGEMENT SYSTEM\n";
+    out << "  (Stocking Hardy Harmonious Hard copies)\n";
+    out.fill('=', 60) << '\n';
+    out << "Library successfully initialized!\n";
+    out << "Publications loaded: " << totalPublications << '\n';
+    out << "Clients registered: " << totalClients << '\n';
+    out << "System ready for command processing.\n";
+    out.fill('=', 60) << "\n\n";
 }
 
 // ----------------------------------------------------------------------------
@@ -17,18 +17,26 @@
 #include "mediaContainer.h"
 #include "clientManager.h"
 #include "commandFactory.h"
+#include "commandPipeline.h"
 #include "publicationFactory.h"
+#include "mappedFile.h"
+#include "compressedReader.h"
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 using namespace std;
 
 class Library {
 public:
     
-    // Default Constructor
-    Library();
+    // Default Constructor, backend selects the publication tree storage,
+    // useArena places each catalog in slab arenas instead of the heap and
+    // loadThreads sets how many threads parse data files (0 = one per core)
+    Library(CatalogBackend backend = BINARY_TREE_BACKEND, bool useArena = false,
+            int loadThreads = 1);
     
   
     // Destructor
@@ -46,21 +54,41 @@ public:
     // Shows complete library status (all publications)
     void displayLibrary() const;
     
-    // Shows all registered library clients
+    // Shows all registered library clients ordered by name
     void displayClients() const;
+
+    // Shows clients whose last name starts with prefix; a trailing '*'
+    // ("Smi*") is accepted and ignored
+    void displayClientsByName(const string& prefix) const;
     
     // Shows library system statistics
     void displayStatistics() const;
+
+    // Writes catalog (with current copy counts), clients and statistics
+    // to a binary snapshot file
+    bool saveSnapshot(const string& filename) const;
+
+    // Restores a library saved with saveSnapshot instead of initialize();
+    // strings are used in place from the mapped file
+    bool loadSnapshot(const string& filename);
     
     // Checks if library system is ready for operation
     bool isInitialized() const;
 
+    // Selects pipelined command processing: reading and parsing run on
+    // their own threads while commands execute, for large command files
+    void setPipelinedCommands(bool pipelined);
+
 private:
+    MappedFile snapshot;              // Loaded snapshot; declared first so it
+                                      // outlives the strings viewing it
     MediaContainer publications;      // Publication management system
     ClientManager clients;            // Client management system  
     CommandFactory factory;           // Command creation and processing system
     PublicationFactory pubFactory;    // Factory for creating publications
     bool initialized;                 // Initialization status flag
+    int loadThreads;                  // Threads used to parse data files
+    bool pipelinedCommands;           // Process commands through the pipeline
     
     // Statistics tracking
     int totalPublications;            // Total publications in library
@@ -69,6 +97,9 @@ private:
 
     // Loads publication data from file into library system
     int loadPublications(const string& filename);
+
+    // Parses publication lines of chunk into records (no shared state)
+    static void parsePublications(string_view chunk, vector<MediaRecord>& records);
     
 
     // Loads client data from file into library system
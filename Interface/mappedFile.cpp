@@ -0,0 +1,110 @@
+/*
+ -----------------------------------------------------------------------------
+ File: mappedFile.cpp
+ Description: Implementation of MappedFile. Maps the file with mmap and
+              advises the kernel the pages will be read sequentially.
+ Author: Sharjeel Khan
+ Assumptions: File is not truncated by another process while mapped
+ -----------------------------------------------------------------------------
+*/
+
+#include "mappedFile.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SSSS_HAVE_MMAP 1
+#else
+#include <fstream>
+#include <sstream>
+#endif
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+// Default Constructor
+// Initializes closed file with no mapping
+MappedFile::MappedFile() : data(nullptr), size(0), mapped(false) {
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Releases the mapping
+MappedFile::~MappedFile() {
+    close();
+}
+
+// ----------------------------------------------------------------------------
+// open
+// Maps the whole file read-only. Empty files open with empty contents
+// Returns true on success, false if file cannot be opened or mapped
+bool MappedFile::open(const string& path) {
+    close();
+#ifdef SSSS_HAVE_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+    size = (size_t)info.st_size;
+    if (size > 0) {
+        void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            ::close(fd);
+            size = 0;
+            return false;
+        }
+        madvise(address, size, MADV_SEQUENTIAL);
+        data = static_cast<const char*>(address);
+    }
+    ::close(fd);                      // Mapping stays valid after close
+#else
+    ifstream file(path, ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    ostringstream contents;
+    contents << file.rdbuf();
+    buffer = contents.str();
+    data = buffer.data();
+    size = buffer.size();
+#endif
+    mapped = true;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// close
+// Unmaps file; views into the old contents become invalid
+void MappedFile::close() {
+#ifdef SSSS_HAVE_MMAP
+    if (data != nullptr) {
+        munmap(const_cast<char*>(data), size);
+    }
+#else
+    buffer.clear();
+#endif
+    data = nullptr;
+    size = 0;
+    mapped = false;
+}
+
+// ----------------------------------------------------------------------------
+// isOpen
+// Returns true if a file is mapped
+bool MappedFile::isOpen() const {
+    return mapped;
+}
+
+// ----------------------------------------------------------------------------
+// getContents
+// Returns view of the mapped bytes
+string_view MappedFile::getContents() const {
+    return string_view(data, size);
+}
@@ -0,0 +1,55 @@
+/*
+ -----------------------------------------------------------------------------
+ File: mappedFile.h
+ Description: Read-only memory-mapped view of a file. The loaders scan the
+              mapped bytes directly as a string_view, so a data file is
+              never copied line by line into strings or streams.
+ Author: Sharjeel Khan
+ Assumptions: POSIX mmap is available (other platforms read the file into
+              a heap buffer instead)
+              Views into the contents are only used while the file is open
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+class MappedFile {
+public:
+    // Creates closed file
+    MappedFile();
+
+    // Unmaps file if open
+    ~MappedFile();
+
+    // Maps whole file read-only, closing any previous mapping
+    // Returns false if file cannot be opened or mapped
+    bool open(const string& path);
+
+    // Unmaps file, invalidating views into its contents
+    void close();
+
+    // Returns true if a file is mapped
+    bool isOpen() const;
+
+    // Returns view of the file's bytes (empty when closed)
+    string_view getContents() const;
+
+private:
+    const char* data;                 // Start of mapped bytes
+    size_t size;                      // Length of file in bytes
+    bool mapped;                      // File open (an empty file maps nothing)
+    string buffer;                    // File contents when mmap is unavailable
+
+    // Mapping is a unique resource, copying is not supported
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+};
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,73 @@
+/*
+ -----------------------------------------------------------------------------
+ File: snapshot.h
+ Description: On-disk layout of a Library snapshot. A snapshot is a header
+              followed by fixed-size string, publication and client tables
+              and one blob holding every distinct string once. Records
+              refer to strings by index into the string table, so loading
+              needs no text parsing: strings are used in place from the
+              mapped file and records are copied straight into objects.
+ Author: Sharjeel Khan
+ Assumptions: Snapshots are read on a machine with the byte order they
+              were written with (checked through SNAPSHOT_BYTE_ORDER)
+              Layout changes bump SNAPSHOT_VERSION
+ -----------------------------------------------------------------------------
+*/
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstdint>
+
+// Format identification
+const char SNAPSHOT_MAGIC[8] = {'S', 'S', 'S', 'S', 'S', 'N', 'A', 'P'};
+const uint32_t SNAPSHOT_VERSION = 2;
+const uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304;
+const uint32_t SNAPSHOT_NO_STRING = 0xFFFFFFFF;   // Index of an empty string
+const uint64_t SNAPSHOT_ALIGNMENT = 8;            // Section start alignment
+
+// File header, at offset 0
+struct SnapshotHeader {
+    char magic[8];                    // SNAPSHOT_MAGIC
+    uint32_t version;                 // SNAPSHOT_VERSION
+    uint32_t byteOrder;               // SNAPSHOT_BYTE_ORDER as written
+    uint64_t stringCount;             // Entries in string table
+    uint64_t publicationCount;        // Entries in publication table
+    uint64_t clientCount;             // Entries in client table
+    uint64_t stringOffset;            // File offset of string table
+    uint64_t publicationOffset;       // File offset of publication table
+    uint64_t clientOffset;            // File offset of client table
+    uint64_t blobOffset;              // File offset of string blob
+    uint64_t blobSize;                // Bytes in string blob
+    int32_t totalPublications;        // Library statistics counters
+    int32_t totalClients;
+    int32_t totalCommandsProcessed;
+    int32_t reserved;                 // Zero
+};
+
+// One distinct string, located in the blob
+struct SnapshotString {
+    uint64_t offset;                  // Offset from start of blob
+    uint32_t length;                  // Length in bytes (no terminator)
+    uint32_t reserved;                // Zero
+};
+
+// One publication, tables hold each type's items in catalog order
+struct SnapshotPublication {
+    uint32_t author;                  // String index or SNAPSHOT_NO_STRING
+    uint32_t title;                   // String index or SNAPSHOT_NO_STRING
+    int32_t year;
+    int32_t month;                    // Zero for non-periodicals
+    int32_t copies;                   // Available copies when saved
+    char type;                        // Publication type code
+    char reserved[3];                 // Zero
+};
+
+// One client, in hash table display order
+struct SnapshotClient {
+    int64_t id;
+    uint32_t firstName;               // String index or SNAPSHOT_NO_STRING
+    uint32_t lastName;                // String index or SNAPSHOT_NO_STRING
+};
+
+#endif // SNAPSHOT_H
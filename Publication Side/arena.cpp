@@ -0,0 +1,111 @@
+/*
+-----------------------------------------------------------------------------
+ File: arena.cpp
+ Description: Implementation of Arena slab allocator. Slabs are chained
+              through a small header at their start; allocation bumps a
+              cursor and only touches the system allocator when a slab
+              fills up.
+ Author: Sharjeel Khan
+ Assumptions: Requested alignments are powers of two no larger than
+              alignof(max_align_t)
+-----------------------------------------------------------------------------
+*/
+
+#include "arena.h"
+#include <cstdint>
+#include <new>
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+// Constructor
+// Initializes empty arena with given slab size
+// No memory allocated until first request
+Arena::Arena(size_t slabSize)
+    : slabs(nullptr), cursor(nullptr), limit(nullptr), slabSize(slabSize),
+      bytesUsed(0), slabCount(0) {
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Frees all slabs
+Arena::~Arena() {
+    release();
+}
+
+// ----------------------------------------------------------------------------
+// release
+// Returns every slab to the system in one pass over the slab chain
+// Arena is empty, all memory previously handed out is invalid
+void Arena::release() {
+    while (slabs != nullptr) {
+        Slab* next = slabs->next;
+        ::operator delete(slabs);
+        slabs = next;
+    }
+    cursor = nullptr;
+    limit = nullptr;
+    bytesUsed = 0;
+    slabCount = 0;
+}
+
+// ----------------------------------------------------------------------------
+// getBytesUsed
+// Returns bytes handed out since last release
+size_t Arena::getBytesUsed() const {
+    return bytesUsed;
+}
+
+// ----------------------------------------------------------------------------
+// getSlabCount
+// Returns number of slabs currently held
+size_t Arena::getSlabCount() const {
+    return slabCount;
+}
+
+// ----------------------------------------------------------------------------
+// do_allocate
+// Aligns cursor and bumps it past the requested bytes
+// Returns pointer to bytes of storage, new slab added if current is full
+void* Arena::do_allocate(size_t bytes, size_t alignment) {
+    uintptr_t aligned = (reinterpret_cast<uintptr_t>(cursor) + alignment - 1)
+                        & ~(uintptr_t)(alignment - 1);
+    if (cursor == nullptr || aligned + bytes > reinterpret_cast<uintptr_t>(limit)) {
+        addSlab(bytes + alignment);
+        aligned = (reinterpret_cast<uintptr_t>(cursor) + alignment - 1)
+                  & ~(uintptr_t)(alignment - 1);
+    }
+    cursor = reinterpret_cast<char*>(aligned + bytes);
+    bytesUsed += bytes;
+    return reinterpret_cast<void*>(aligned);
+}
+
+// ----------------------------------------------------------------------------
+// do_deallocate
+// Individual frees are ignored; memory is reclaimed by release()
+void Arena::do_deallocate(void*, size_t, size_t) {
+}
+
+// ----------------------------------------------------------------------------
+// do_is_equal
+// Memory from one arena can only be returned to that same arena
+bool Arena::do_is_equal(const pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+// ----------------------------------------------------------------------------
+// addSlab
+// Allocates a regular slab, or an oversized one for large requests
+// cursor and limit point into the new slab
+void Arena::addSlab(size_t bytes) {
+    size_t usable = bytes > slabSize ? bytes : slabSize;
+    char* memory = static_cast<char*>(::operator new(sizeof(Slab) + usable));
+
+    Slab* slab = reinterpret_cast<Slab*>(memory);
+    slab->next = slabs;
+    slabs = slab;
+    slabCount++;
+
+    cursor = memory + sizeof(Slab);
+    limit = cursor + usable;
+}
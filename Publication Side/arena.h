@@ -0,0 +1,74 @@
+/*
+-----------------------------------------------------------------------------
+ File: arena.h
+ Description: Slab arena allocator. Hands out memory by bumping a pointer
+              through large slabs and frees everything at once, so a whole
+              catalog generation (tree nodes and publications) can be
+              built without per-object new/delete and torn down in a
+              single release. Implements pmr::memory_resource so
+              standard pmr containers and strings can allocate from it.
+ Author: Sharjeel Khan
+ Assumptions: Objects placed in the arena are never freed individually
+              Objects placed in the arena do not outlive release()
+              Arena is used from one thread at a time
+-----------------------------------------------------------------------------
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+
+using namespace std;
+
+class Arena : public pmr::memory_resource {
+public:
+    // Creates empty arena; slabs are allocated lazily
+    explicit Arena(size_t slabSize = DEFAULT_SLAB_SIZE);
+
+    // Frees all slabs
+    virtual ~Arena();
+
+    // Frees every slab at once, invalidating all memory handed out
+    void release();
+
+    // Bytes handed out since last release
+    size_t getBytesUsed() const;
+
+    // Number of slabs currently held
+    size_t getSlabCount() const;
+
+protected:
+    // Bump-allocates bytes with the requested alignment
+    virtual void* do_allocate(size_t bytes, size_t alignment) override;
+
+    // Individual frees are ignored, memory returns on release()
+    virtual void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+
+    // Arenas are only interchangeable with themselves
+    virtual bool do_is_equal(const pmr::memory_resource& other) const noexcept override;
+
+private:
+    static const size_t DEFAULT_SLAB_SIZE = 1 << 20;   // 1 MB
+
+    struct Slab {
+        Slab* next;                   // Previously allocated slab
+    };
+
+    Slab* slabs;                      // Most recent slab, chained to older ones
+    char* cursor;                     // Next free byte in current slab
+    char* limit;                      // End of current slab
+    size_t slabSize;                  // Usable size of a regular slab
+    size_t bytesUsed;                 // Bytes handed out since last release
+    size_t slabCount;                 // Slabs currently held
+
+    // Allocates a new slab with at least bytes usable space
+    void addSlab(size_t bytes);
+
+    // Arenas own raw memory, copying is not supported
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+};
+
+#endif // ARENA_H
@@ -4,6 +4,7 @@
  Description: Implementation of Binary Search Tree for Media* objects.
               Maintains sorted order without owning the Media objects.
               Tree acts as pure container following professor's guidelines.
+              AVL rotations keep height O(log n) for any insertion order.
  Author: Sharjeel Khan
  Assumptions: Media objects exist for lifetime of tree usage
               Comparison operators work correctly for sorting
@@ -17,8 +18,8 @@ using namespace std;
 // ----------------------------------------------------------------------------
 // Default Constructor
 // Initializes empty binary search tree
-// Tree created with null root
-BinTree::BinTree() : root(nullptr) {
+// Tree created with null root, arena created when useArena is set
+BinTree::BinTree(bool useArena) : MediaTree(useArena), root(nullptr) {
 }
 
 // ----------------------------------------------------------------------------
@@ -31,99 +32,297 @@ BinTree::~BinTree() {
 
 // ----------------------------------------------------------------------------
 // makeEmpty
-// Removes all nodes from tree, preserving Media objects
+// Removes all nodes from tree. In arena mode nodes and Media live in the
+// arena, so dropping them is a single release instead of a tree walk
 // Tree is empty, ready for new insertions
 void BinTree::makeEmpty() {
-    destroy(root);
+    if (arena != nullptr) {
+        arena->release();
+    } else {
+        destroy(root);
+    }
     root = nullptr;
 }
 
+// ----------------------------------------------------------------------------
+// createNode
+// Allocates node from the arena when present, otherwise from the heap
+// Returns new leaf node holding media
+BinTree::Node* BinTree::createNode(Media* media) {
+    if (arena != nullptr) {
+        return new (arena->allocate(sizeof(Node), alignof(Node))) Node(media);
+    }
+    return new Node(media);
+}
+
 // ----------------------------------------------------------------------------
 // destroy
-// Recursively deallocates tree nodes without touching Media objects
-// All nodes in subtree deallocated, Media objects untouched
+// Iteratively deallocates tree nodes and the Media they hold
+// Left children are rotated up until none remain, so the subtree is
+// flattened into a right spine and freed without a stack
 void BinTree::destroy(Node* node) {
-    if (node != nullptr) {
-        destroy(node->left);
-        destroy(node->right);
-        // Delete the Media object - tree owns the publications
-        delete node->data;
-        delete node;
+    while (node != nullptr) {
+        if (node->left != nullptr) {
+            Node* leftChild = node->left;
+            node->left = leftChild->right;
+            leftChild->right = node;
+            node = leftChild;
+        } else {
+            Node* next = node->right;
+            // Delete the Media object - tree owns the publications
+            delete node->data;
+            delete node;
+            node = next;
+        }
     }
 }
 
 // ----------------------------------------------------------------------------
 // insert
-// Public interface for inserting Media pointer into tree
-// Media inserted in BST order if not duplicate
+// Inserts Media maintaining BST property using an explicit path of links
+// Media inserted in correct position, tree remains valid balanced BST
 bool BinTree::insert(Media* media) {
     if (media == nullptr) {
         return false;
     }
-    return insert(root, media);
+
+    Node** path[MAX_HEIGHT];          // Links walked from root to new node
+    int depth = 0;
+    Node** link = &root;
+
+    while (*link != nullptr) {
+        Node* node = *link;
+        path[depth++] = link;
+        int order = media->compareTo(*node->data);
+        if (order < 0) {
+            link = &node->left;
+        } else if (order > 0) {
+            link = &node->right;
+        } else {
+            // Duplicate found (*media == *node->data)
+            // Don't insert duplicates, return false
+            return false;
+        }
+    }
+    *link = createNode(media);
+
+    // Walk back up rebalancing; stop once a subtree height is unchanged
+    while (depth > 0) {
+        Node*& node = *path[--depth];
+        int oldHeight = node->height;
+        rebalance(node);
+        if (node->height == oldHeight) {
+            break;
+        }
+    }
+    return true;
 }
 
 // ----------------------------------------------------------------------------
-// insert (private helper)
-// Recursively inserts Media maintaining BST property
-// Media inserted in correct position, tree remains valid BST
-bool BinTree::insert(Node*& node, Media* media) {
-    if (node == nullptr) {
-        node = new Node(media);
-        return true;
-    } else if (*media < *node->data) {
-        return insert(node->left, media);
-    } else if (*node->data < *media) {
-        return insert(node->right, media);
-    } else {
-        // Duplicate found (*media == *node->data)
-        // Don't insert duplicates, return false
+// buildFromSorted
+// Builds tree from strictly ascending items by taking each range's middle
+// item as subtree root, so every insert-time descent is skipped
+// Returns false without taking items if tree is not empty
+bool BinTree::buildFromSorted(const vector<Media*>& sorted) {
+    if (root != nullptr) {
         return false;
     }
+    root = buildBalanced(sorted, 0, sorted.size());
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// buildBalanced
+// Creates subtree for sorted[low, high) rooted at the middle item
+// Returns subtree root with heights set, nullptr for an empty range
+BinTree::Node* BinTree::buildBalanced(const vector<Media*>& sorted,
+                                      size_t low, size_t high) {
+    if (low >= high) {
+        return nullptr;
+    }
+    size_t mid = low + (high - low) / 2;
+    Node* node = createNode(sorted[mid]);
+    node->left = buildBalanced(sorted, low, mid);
+    node->right = buildBalanced(sorted, mid + 1, high);
+    updateHeight(node);
+    return node;
 }
 
 // ----------------------------------------------------------------------------
 // retrieve
-// Public interface for finding Media object in tree
+// Finds Media object equal to target via its lookup key
 // found set to matching Media* or nullptr
 bool BinTree::retrieve(const Media& target, Media*& found) const {
-    return retrieve(root, target, found);
+    return retrieve(target.getKey(), found);
 }
 
 // ----------------------------------------------------------------------------
-// retrieve (private helper)
-// Recursively searches for Media object matching target
-// found points to matching Media* if exists, nullptr otherwise
-bool BinTree::retrieve(Node* node, const Media& target, Media*& found) const {
-    if (node == nullptr) {
-        found = nullptr;
-        return false;
-    } else if (target == *node->data) {
-        found = node->data;
-        return true;
-    } else if (target < *node->data) {
-        return retrieve(node->left, target, found);
-    } else {
-        return retrieve(node->right, target, found);
+// retrieve (lookup key)
+// Iteratively searches for Media object matching key, one three-way
+// sort key comparison per level
+// found set to matching Media* or nullptr
+bool BinTree::retrieve(const MediaKey& key, Media*& found) const {
+    Node* node = root;
+    while (node != nullptr) {
+        int order = node->data->compareTo(key);
+        if (order == 0) {
+            found = node->data;
+            return true;
+        } else if (order > 0) {
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+    found = nullptr;
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// retrieveRange
+// In-order traversal that skips subtrees entirely below low and stops
+// once past high
+// Matching Media appended to found in ascending order, returns count added
+int BinTree::retrieveRange(const Media& low, const Media& high,
+                           vector<Media*>& found) const {
+    Node* pending[MAX_HEIGHT];        // Ancestors whose right side is unvisited
+    int count = 0;
+    int added = 0;
+    Node* node = root;
+
+    while (node != nullptr || count > 0) {
+        while (node != nullptr) {
+            if (node->data->compareTo(low) < 0) {
+                node = node->right;   // Whole left side is below the range
+            } else {
+                pending[count++] = node;
+                node = node->left;
+            }
+        }
+        if (count == 0) {
+            break;
+        }
+        node = pending[--count];
+        if (high.compareTo(*node->data) < 0) {
+            break;                    // Everything remaining is above range
+        }
+        found.push_back(node->data);
+        added++;
+        node = node->right;
+    }
+    return added;
+}
+
+// ----------------------------------------------------------------------------
+// collectAll
+// Iterative in-order walk appending every item
+// All Media appended to found in ascending order
+void BinTree::collectAll(vector<Media*>& found) const {
+    Node* pending[MAX_HEIGHT];        // Ancestors whose right side is unvisited
+    int count = 0;
+    Node* node = root;
+
+    while (node != nullptr || count > 0) {
+        while (node != nullptr) {
+            pending[count++] = node;
+            node = node->left;
+        }
+        node = pending[--count];
+        found.push_back(node->data);
+        node = node->right;
     }
 }
 
 // ----------------------------------------------------------------------------
 // display
 // Public interface for displaying all Media objects in sorted order
-// All Media objects displayed via in-order traversal
-void BinTree::display() const {
-    display(root);
+// All Media objects appended to out via in-order traversal
+void BinTree::display(OutputSink& out) const {
+    display(root, out);
 }
 
 // ----------------------------------------------------------------------------
 // display (private helper)
-// Performs in-order traversal to display Media objects in sorted order
+// In-order traversal with an explicit stack sized to the subtree height
 // All Media objects in subtree displayed in ascending order
-void BinTree::display(Node* node) const {
-    if (node != nullptr) {
-        display(node->left);          // Display left subtree first
-        node->data->display(cout);    // Display current node
-        display(node->right);         // Display right subtree last
+void BinTree::display(Node* node, OutputSink& out) const {
+    Node* pending[MAX_HEIGHT];        // Ancestors whose right side is unvisited
+    int count = 0;
+
+    while (node != nullptr || count > 0) {
+        while (node != nullptr) {     // Descend to leftmost unvisited node
+            pending[count++] = node;
+            node = node->left;
+        }
+        node = pending[--count];
+        node->data->display(out);     // Display current node
+        node = node->right;           // Display right subtree next
+    }
+}
+
+// ----------------------------------------------------------------------------
+// height
+// Returns height of subtree rooted at node
+// Empty subtree has height 0
+int BinTree::height(const Node* node) {
+    return node == nullptr ? 0 : node->height;
+}
+
+// ----------------------------------------------------------------------------
+// updateHeight
+// Recomputes node height from its children
+// node->height is one more than its taller child
+void BinTree::updateHeight(Node* node) {
+    int leftHeight = height(node->left);
+    int rightHeight = height(node->right);
+    node->height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+}
+
+// ----------------------------------------------------------------------------
+// rotateLeft
+// Promotes right child of node to subtree root
+// In-order sequence unchanged, node points to new subtree root
+void BinTree::rotateLeft(Node*& node) {
+    Node* pivot = node->right;
+    node->right = pivot->left;
+    pivot->left = node;
+    updateHeight(node);
+    updateHeight(pivot);
+    node = pivot;
+}
+
+// ----------------------------------------------------------------------------
+// rotateRight
+// Promotes left child of node to subtree root
+// In-order sequence unchanged, node points to new subtree root
+void BinTree::rotateRight(Node*& node) {
+    Node* pivot = node->left;
+    node->left = pivot->right;
+    pivot->right = node;
+    updateHeight(node);
+    updateHeight(pivot);
+    node = pivot;
+}
+
+// ----------------------------------------------------------------------------
+// rebalance
+// Restores AVL property at node after insertion into one of its subtrees
+// Child heights differ by at most 1, node height up to date
+void BinTree::rebalance(Node*& node) {
+    updateHeight(node);
+    int balance = height(node->left) - height(node->right);
+
+    if (balance > 1) {
+        // Left heavy - left-right case needs a rotation of the child first
+        if (height(node->left->left) < height(node->left->right)) {
+            rotateLeft(node->left);
+        }
+        rotateRight(node);
+    } else if (balance < -1) {
+        // Right heavy - right-left case needs a rotation of the child first
+        if (height(node->right->right) < height(node->right->left)) {
+            rotateRight(node->right);
+        }
+        rotateLeft(node);
     }
-}
\ No newline at end of file
+}
@@ -3,7 +3,8 @@
  File: bintree.h
  Description: Binary Search Tree implementation for Media objects. Maintains
               sorted order based on Media comparison operators. Container only
-              stores pointers
+              stores pointers. Tree is self-balancing (AVL) so sorted input
+              does not degrade it into a linked list
  Author: Sharjeel Khan
  Assumptions: Media objects have properly implemented < and == operators
               Media objects are managed elsewhere (not owned by tree)
@@ -14,59 +15,93 @@
 #define BINTREE_H
 
 #include "media.h"
+#include "mediaTree.h"
 #include <iostream>
+#include <vector>
 
-class BinTree {
+class BinTree : public MediaTree {
 public:
-    // Creates empty binary search tree
-    BinTree();
+    // Creates empty binary search tree, nodes and Media in an arena if set
+    BinTree(bool useArena = false);
     
     // Cleans up all tree nodes (but not the Media objects they point to)
-    ~BinTree();
+    virtual ~BinTree();
    
     // Inserts Media pointer into tree in sorted order
-    bool insert(Media* media);
+    virtual bool insert(Media* media) override;
+
+    // Builds a perfectly balanced tree from strictly ascending items
+    virtual bool buildFromSorted(const vector<Media*>& sorted) override;
     
     
     // Finds Media object matching target in the tree
-    bool retrieve(const Media& target, Media*& found) const;
+    virtual bool retrieve(const Media& target, Media*& found) const override;
+
+    // Finds Media object matching lookup key in the tree
+    virtual bool retrieve(const MediaKey& key, Media*& found) const override;
+
+    // Appends Media objects in [low, high] to found (in-order traversal)
+    virtual int retrieveRange(const Media& low, const Media& high,
+                              vector<Media*>& found) const override;
     
 
+    // Appends all Media objects to found (in-order traversal)
+    virtual void collectAll(vector<Media*>& found) const override;
+
     // Displays all Media objects in sorted order (in-order traversal)
-    void display() const;
+    virtual void display(OutputSink& out) const override;
     
 
-    // Removes all nodes from tree without deleting Media objects
-    void makeEmpty();
+    // Removes all nodes from tree; in arena mode releases the whole arena
+    virtual void makeEmpty() override;
 
 private:
     struct Node {
         Media* data;                  // Pointer to Media object 
         Node* left;                   // Left child pointer
         Node* right;                  // Right child pointer
+        int height;                   // Height of subtree rooted here (leaf = 1)
 
         // Node constructor
-        Node(Media* m) : data(m), left(nullptr), right(nullptr) {}
+        Node(Media* m) : data(m), left(nullptr), right(nullptr), height(1) {}
     };
 
+    // Upper bound on AVL height: 1.44 * log2(n) stays below this for any
+    // node count that fits in memory, so insert paths fit in a fixed array
+    static const int MAX_HEIGHT = 96;
+
     Node* root;                       // Root of the binary search tree
 
-    // Private helper methods for recursive operations
-    
-    // makeEmpty helper 
-    void makeEmpty(Node*& node);
-    
-    // insert helper
-    bool insert(Node*& node, Media* media);
-    
-    // retrieve helper 
-    bool retrieve(Node* node, const Media& target, Media*& found) const;
+    // Private helper methods. All traversals are iterative so tree depth
+    // never translates into call stack depth
     
+    // Allocates a node from the arena or the heap
+    Node* createNode(Media* media);
+
+    // Builds balanced subtree from sorted[low, high); recursion depth is
+    // log2 of the item count
+    Node* buildBalanced(const vector<Media*>& sorted, size_t low, size_t high);
+
     // display helper
-    void display(Node* node) const;
+    void display(Node* node, OutputSink& out) const;
     
     // destroy helper 
     void destroy(Node* node);
+
+    // AVL balancing helpers
+
+    // Returns height of subtree (0 for empty)
+    static int height(const Node* node);
+
+    // Recomputes node height from its children
+    static void updateHeight(Node* node);
+
+    // Rotates subtree left/right around node, node updated to new subtree root
+    static void rotateLeft(Node*& node);
+    static void rotateRight(Node*& node);
+
+    // Restores AVL balance at node after an insertion below it
+    static void rebalance(Node*& node);
 };
 
 #endif // BINTREE_H
\ No newline at end of file
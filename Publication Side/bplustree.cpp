@@ -0,0 +1,416 @@
+/*
+-----------------------------------------------------------------------------
+ File: bplustree.cpp
+ Description: Implementation of B+ tree for Media* objects. All Media live
+              in leaves; inner nodes only hold separator keys used to
+              route searches. Leaves are chained for sequential scans.
+ Author: Sharjeel Khan
+ Assumptions: Media objects exist for lifetime of tree usage
+              Comparison operators work correctly for sorting
+-----------------------------------------------------------------------------
+*/
+
+#include "bplustree.h"
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+// Default Constructor
+// Initializes empty B+ tree
+// Tree created with no nodes, arena created when useArena is set
+BPlusTree::BPlusTree(bool useArena)
+    : MediaTree(useArena), root(nullptr), head(nullptr) {
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Cleans up all nodes and the Media objects they own
+BPlusTree::~BPlusTree() {
+    makeEmpty();
+}
+
+// ----------------------------------------------------------------------------
+// makeEmpty
+// Removes all nodes and Media objects from tree, in arena mode by
+// releasing the arena they all live in
+// Tree is empty, ready for new insertions
+void BPlusTree::makeEmpty() {
+    if (arena != nullptr) {
+        arena->release();
+    } else {
+        destroy(root);
+    }
+    root = nullptr;
+    head = nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// createLeaf
+// Allocates empty leaf from the arena when present, otherwise from the heap
+BPlusTree::Leaf* BPlusTree::createLeaf() {
+    if (arena != nullptr) {
+        return new (arena->allocate(sizeof(Leaf), alignof(Leaf))) Leaf();
+    }
+    return new Leaf();
+}
+
+// ----------------------------------------------------------------------------
+// createInner
+// Allocates empty inner node from the arena when present, otherwise the heap
+BPlusTree::Inner* BPlusTree::createInner() {
+    if (arena != nullptr) {
+        return new (arena->allocate(sizeof(Inner), alignof(Inner))) Inner();
+    }
+    return new Inner();
+}
+
+// ----------------------------------------------------------------------------
+// destroy
+// Deallocates subtree nodes, deleting Media held in leaves
+// All nodes in subtree deallocated
+void BPlusTree::destroy(Node* node) {
+    if (node == nullptr) {
+        return;
+    }
+    if (node->isLeaf) {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        for (int i = 0; i < leaf->count; ++i) {
+            // Delete the Media object - tree owns the publications
+            delete leaf->items[i];
+        }
+        delete leaf;
+    } else {
+        Inner* inner = static_cast<Inner*>(node);
+        for (int i = 0; i < inner->count; ++i) {
+            destroy(inner->children[i]);
+        }
+        delete inner;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// compareEntry
+// Compares target against an entry's inline key, falling back to the full
+// field comparison only when the keys are equal
+// Returns negative, zero or positive as target sorts before, equal or after
+int BPlusTree::compareEntry(const MediaKey& target, uint64_t key, const Media* item) {
+    if (target.sortKey != key) {
+        return target.sortKey < key ? -1 : 1;
+    }
+    return -item->compareFields(target);
+}
+
+// ----------------------------------------------------------------------------
+// childIndex
+// Binary search for the last child whose separator is <= target
+// Returns child index in [0, count-1]
+int BPlusTree::childIndex(const Inner* node, const MediaKey& target) {
+    int low = 1;
+    int high = node->count;           // Search separators[1..count-1]
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (compareEntry(target, node->keys[mid], node->separators[mid]) < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return low - 1;
+}
+
+// ----------------------------------------------------------------------------
+// lowerBound
+// Binary search for first item in leaf not less than target
+// Returns position in [0, count]
+int BPlusTree::lowerBound(const Leaf* leaf, const MediaKey& target) {
+    int low = 0;
+    int high = leaf->count;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (compareEntry(target, leaf->keys[mid], leaf->items[mid]) > 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// ----------------------------------------------------------------------------
+// findLeaf
+// Descends from root following separators
+// Returns leaf that would contain target, or nullptr for empty tree
+const BPlusTree::Leaf* BPlusTree::findLeaf(const MediaKey& target) const {
+    const Node* node = root;
+    if (node == nullptr) {
+        return nullptr;
+    }
+    while (!node->isLeaf) {
+        const Inner* inner = static_cast<const Inner*>(node);
+        node = inner->children[childIndex(inner, target)];
+    }
+    return static_cast<const Leaf*>(node);
+}
+
+// ----------------------------------------------------------------------------
+// insert
+// Inserts Media into its leaf, splitting full nodes on the way back up
+// Media inserted in sorted position if not duplicate
+bool BPlusTree::insert(Media* media) {
+    if (media == nullptr) {
+        return false;
+    }
+    if (root == nullptr) {
+        Leaf* leaf = createLeaf();
+        leaf->keys[0] = media->getSortKey();
+        leaf->items[0] = media;
+        leaf->count = 1;
+        root = leaf;
+        head = leaf;
+        return true;
+    }
+
+    // Descend, remembering the inner nodes and child slots taken
+    MediaKey mediaKey = media->getKey();
+    Inner* path[MAX_DEPTH];
+    int slots[MAX_DEPTH];
+    int depth = 0;
+    Node* node = root;
+    while (!node->isLeaf) {
+        Inner* inner = static_cast<Inner*>(node);
+        int slot = childIndex(inner, mediaKey);
+        path[depth] = inner;
+        slots[depth] = slot;
+        depth++;
+        node = inner->children[slot];
+    }
+
+    Leaf* leaf = static_cast<Leaf*>(node);
+    int pos = lowerBound(leaf, mediaKey);
+    if (pos < leaf->count && compareEntry(mediaKey, leaf->keys[pos], leaf->items[pos]) == 0) {
+        // Duplicate found, don't insert
+        return false;
+    }
+
+    for (int i = leaf->count; i > pos; --i) {
+        leaf->keys[i] = leaf->keys[i - 1];
+        leaf->items[i] = leaf->items[i - 1];
+    }
+    leaf->keys[pos] = media->getSortKey();
+    leaf->items[pos] = media;
+    leaf->count++;
+    if (leaf->count <= LEAF_CAPACITY) {
+        return true;
+    }
+
+    // Leaf overflowed - split and push separators upward as needed
+    Leaf* rightLeaf = splitLeaf(leaf);
+    uint64_t key = rightLeaf->keys[0];
+    Media* separator = rightLeaf->items[0];
+    Node* newChild = rightLeaf;
+
+    while (depth > 0) {
+        depth--;
+        Inner* parent = path[depth];
+        int at = slots[depth] + 1;
+        for (int i = parent->count; i > at; --i) {
+            parent->keys[i] = parent->keys[i - 1];
+            parent->separators[i] = parent->separators[i - 1];
+            parent->children[i] = parent->children[i - 1];
+        }
+        parent->keys[at] = key;
+        parent->separators[at] = separator;
+        parent->children[at] = newChild;
+        parent->count++;
+        if (parent->count <= INNER_CAPACITY) {
+            return true;
+        }
+        newChild = splitInner(parent, key, separator);
+    }
+
+    // Root split - tree grows one level
+    Inner* newRoot = createInner();
+    newRoot->keys[0] = 0;
+    newRoot->separators[0] = nullptr;
+    newRoot->children[0] = root;
+    newRoot->keys[1] = key;
+    newRoot->separators[1] = separator;
+    newRoot->children[1] = newChild;
+    newRoot->count = 2;
+    root = newRoot;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// buildFromSorted
+// Fills leaves left to right, then groups each level's nodes under new
+// inner nodes until a single root remains. Every node is written once
+// Returns false without taking items if tree is not empty
+bool BPlusTree::buildFromSorted(const vector<Media*>& sorted) {
+    if (root != nullptr) {
+        return false;
+    }
+    if (sorted.empty()) {
+        return true;
+    }
+
+    // Leaf level, chained in order; firsts[i] is smallest item under level[i]
+    vector<Node*> level;
+    vector<Media*> firsts;
+    Leaf* previous = nullptr;
+    for (size_t i = 0; i < sorted.size(); i += LEAF_CAPACITY) {
+        Leaf* leaf = createLeaf();
+        size_t end = min(sorted.size(), i + LEAF_CAPACITY);
+        for (size_t j = i; j < end; ++j) {
+            leaf->keys[leaf->count] = sorted[j]->getSortKey();
+            leaf->items[leaf->count] = sorted[j];
+            leaf->count++;
+        }
+        if (previous != nullptr) {
+            previous->next = leaf;
+        } else {
+            head = leaf;
+        }
+        previous = leaf;
+        level.push_back(leaf);
+        firsts.push_back(sorted[i]);
+    }
+
+    // Inner levels
+    while (level.size() > 1) {
+        vector<Node*> parents;
+        vector<Media*> parentFirsts;
+        for (size_t i = 0; i < level.size(); i += INNER_CAPACITY) {
+            Inner* inner = createInner();
+            size_t end = min(level.size(), i + INNER_CAPACITY);
+            for (size_t j = i; j < end; ++j) {
+                int slot = inner->count;
+                inner->keys[slot] = slot == 0 ? 0 : firsts[j]->getSortKey();
+                inner->separators[slot] = slot == 0 ? nullptr : firsts[j];
+                inner->children[slot] = level[j];
+                inner->count++;
+            }
+            parents.push_back(inner);
+            parentFirsts.push_back(firsts[i]);
+        }
+        level.swap(parents);
+        firsts.swap(parentFirsts);
+    }
+    root = level[0];
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// splitLeaf
+// Moves upper half of an overfull leaf into a new sibling
+// Returns new right leaf, linked after original in leaf chain
+BPlusTree::Leaf* BPlusTree::splitLeaf(Leaf* leaf) {
+    Leaf* right = createLeaf();
+    int keep = leaf->count / 2;
+    right->count = leaf->count - keep;
+    for (int i = 0; i < right->count; ++i) {
+        right->keys[i] = leaf->keys[keep + i];
+        right->items[i] = leaf->items[keep + i];
+    }
+    leaf->count = keep;
+    right->next = leaf->next;
+    leaf->next = right;
+    return right;
+}
+
+// ----------------------------------------------------------------------------
+// splitInner
+// Moves upper half of an overfull inner node into a new sibling
+// Returns new right node, key and separator set to the entry that moves to
+// the parent
+BPlusTree::Inner* BPlusTree::splitInner(Inner* node, uint64_t& key, Media*& separator) {
+    Inner* right = createInner();
+    int keep = node->count / 2;
+    right->count = node->count - keep;
+    for (int i = 0; i < right->count; ++i) {
+        right->keys[i] = node->keys[keep + i];
+        right->separators[i] = node->separators[keep + i];
+        right->children[i] = node->children[keep + i];
+    }
+    key = right->keys[0];
+    separator = right->separators[0];
+    right->keys[0] = 0;
+    right->separators[0] = nullptr;
+    node->count = keep;
+    return right;
+}
+
+// ----------------------------------------------------------------------------
+// retrieve
+// Finds Media object equal to target via its lookup key
+// found set to matching Media* or nullptr
+bool BPlusTree::retrieve(const Media& target, Media*& found) const {
+    return retrieve(target.getKey(), found);
+}
+
+// ----------------------------------------------------------------------------
+// retrieve (lookup key)
+// Descends to the covering leaf and binary searches it
+// found set to matching Media* or nullptr
+bool BPlusTree::retrieve(const MediaKey& key, Media*& found) const {
+    const Leaf* leaf = findLeaf(key);
+    if (leaf != nullptr) {
+        int pos = lowerBound(leaf, key);
+        if (pos < leaf->count && compareEntry(key, leaf->keys[pos], leaf->items[pos]) == 0) {
+            found = leaf->items[pos];
+            return true;
+        }
+    }
+    found = nullptr;
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// retrieveRange
+// Finds leaf holding low, then streams along the leaf chain until past high
+// Matching Media appended to found in ascending order, returns count added
+int BPlusTree::retrieveRange(const Media& low, const Media& high,
+                             vector<Media*>& found) const {
+    MediaKey lowKey = low.getKey();
+    MediaKey highKey = high.getKey();
+    const Leaf* leaf = findLeaf(lowKey);
+    if (leaf == nullptr) {
+        return 0;
+    }
+    int added = 0;
+    int pos = lowerBound(leaf, lowKey);
+    while (leaf != nullptr) {
+        for (; pos < leaf->count; ++pos) {
+            if (compareEntry(highKey, leaf->keys[pos], leaf->items[pos]) < 0) {
+                return added;
+            }
+            found.push_back(leaf->items[pos]);
+            added++;
+        }
+        leaf = leaf->next;
+        pos = 0;
+    }
+    return added;
+}
+
+// ----------------------------------------------------------------------------
+// collectAll
+// Walks the leaf chain from the leftmost leaf
+// All Media appended to found in ascending order
+void BPlusTree::collectAll(vector<Media*>& found) const {
+    for (const Leaf* leaf = head; leaf != nullptr; leaf = leaf->next) {
+        found.insert(found.end(), leaf->items, leaf->items + leaf->count);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// display
+// Walks the leaf chain from the leftmost leaf
+// All Media objects displayed in ascending order
+void BPlusTree::display(OutputSink& out) const {
+    for (const Leaf* leaf = head; leaf != nullptr; leaf = leaf->next) {
+        for (int i = 0; i < leaf->count; ++i) {
+            leaf->items[i]->display(out);
+        }
+    }
+}
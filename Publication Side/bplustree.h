@@ -0,0 +1,122 @@
+/*
+-----------------------------------------------------------------------------
+ File: bplustree.h
+ Description: B+ tree implementation for Media objects. Alternative catalog
+              backend to BinTree: nodes are wide arrays so a lookup touches
+              a handful of contiguous nodes instead of one allocation per
+              title, and leaves are linked so in-order scans stream through
+              them sequentially. Sort keys are stored inline next to the
+              Media pointers, so searches only dereference a Media when
+              keys collide.
+ Author: Sharjeel Khan
+ Assumptions: Media objects have properly implemented < and == operators
+              Tree owns the Media objects it holds (same as BinTree)
+-----------------------------------------------------------------------------
+*/
+
+#ifndef BPLUSTREE_H
+#define BPLUSTREE_H
+
+#include "media.h"
+#include "mediaTree.h"
+#include <iostream>
+#include <vector>
+
+class BPlusTree : public MediaTree {
+public:
+    // Creates empty B+ tree, nodes and Media in an arena if set
+    BPlusTree(bool useArena = false);
+
+    // Cleans up all tree nodes and the Media objects they hold
+    virtual ~BPlusTree();
+
+    // Inserts Media pointer into its leaf in sorted order
+    virtual bool insert(Media* media) override;
+
+    // Packs strictly ascending items into full leaves and builds inner
+    // levels bottom-up
+    virtual bool buildFromSorted(const vector<Media*>& sorted) override;
+
+    // Finds Media object matching target in the tree
+    virtual bool retrieve(const Media& target, Media*& found) const override;
+
+    // Finds Media object matching lookup key in the tree
+    virtual bool retrieve(const MediaKey& key, Media*& found) const override;
+
+    // Appends Media objects in [low, high] to found by scanning leaves
+    virtual int retrieveRange(const Media& low, const Media& high,
+                              vector<Media*>& found) const override;
+
+    // Appends all Media objects to found by walking the leaf chain
+    virtual void collectAll(vector<Media*>& found) const override;
+
+    // Appends all Media objects to out in sorted order by walking the leaf
+    // chain
+    virtual void display(OutputSink& out) const override;
+
+    // Removes all nodes and Media objects; arena mode releases the arena
+    virtual void makeEmpty() override;
+
+private:
+    static const int LEAF_CAPACITY = 64;    // Max Media per leaf
+    static const int INNER_CAPACITY = 64;   // Max children per inner node
+    static const int MAX_DEPTH = 16;        // Far above any reachable height
+
+    struct Node {
+        bool isLeaf;                  // Leaf or inner node
+        int count;                    // Items (leaf) or children (inner)
+
+        Node(bool leaf) : isLeaf(leaf), count(0) {}
+    };
+
+    struct Leaf : Node {
+        uint64_t keys[LEAF_CAPACITY + 1];   // Inline sort keys of items
+        Media* items[LEAF_CAPACITY + 1];    // Sorted items, +1 slot for split
+        Leaf* next;                         // Next leaf in sorted order
+
+        Leaf() : Node(true), next(nullptr) {}
+    };
+
+    struct Inner : Node {
+        // separators[i] is the smallest item under children[i] and keys[i]
+        // its sort key; slot 0 unused
+        uint64_t keys[INNER_CAPACITY + 1];
+        Media* separators[INNER_CAPACITY + 1];
+        Node* children[INNER_CAPACITY + 1];
+
+        Inner() : Node(false) {}
+    };
+
+    Node* root;                       // Root node (leaf when tree is small)
+    Leaf* head;                       // Leftmost leaf, start of in-order scan
+
+    // Allocates an empty leaf or inner node from the arena or the heap
+    Leaf* createLeaf();
+    Inner* createInner();
+
+    // Three-way compare of target against an entry, using the inline key
+    // and only touching item when the keys are equal
+    static int compareEntry(const MediaKey& target, uint64_t key, const Media* item);
+
+    // Returns index of child of inner node whose range covers target
+    static int childIndex(const Inner* node, const MediaKey& target);
+
+    // Returns first position in leaf whose item is not less than target
+    static int lowerBound(const Leaf* leaf, const MediaKey& target);
+
+    // Descends from root to the leaf whose range covers target
+    const Leaf* findLeaf(const MediaKey& target) const;
+
+    // Splits an overfull leaf, returns new right sibling
+    Leaf* splitLeaf(Leaf* leaf);
+
+    // Splits an overfull inner node, returns new right sibling and the
+    // separator key that moves up to the parent
+    Inner* splitInner(Inner* node, uint64_t& key, Media*& separator);
+
+    // Frees subtree nodes; depth is bounded by the log of the fanout so
+    // recursion here stays shallow
+    void destroy(Node* node);
+};
+
+#endif // BPLUSTREE_H
@@ -11,12 +11,14 @@
 */
 
 #include "children.h"
-#include <iomanip>
+
+// Constants
+const char CHILDREN_CODE = 'C';
 
 //----------------------------------------------------------------------------
 // Constuctor
-// Set copies to 5 for children's publications
-Children::Children() {
+// Set copies to 5 for children's publications, strings interned in pool
+Children::Children(StringPool* pool) : Publication(CHILDREN_CODE, pool) {
     copies = 5;
 }
 
@@ -28,38 +30,84 @@ Children::~Children() = default;
 // setData
 // Format: C author, title, year (same as fiction)
 void Children::setData(istream& in) {
-    getline(in >> ws, author, ',');
-    getline(in >> ws, title, ',');
+    author = readField(in);
+    title = readField(in);
     in >> year;
+    updateSortKey();
+}
+//----------------------------------------------------------------------------
+// setData (line slice)
+// Format: C author, title, year, parsed directly from data without a stream
+void Children::setData(string_view data) {
+    setData(MediaRecord::parse(CHILDREN_CODE, data));
+}
+
+//----------------------------------------------------------------------------
+// setData (record)
+// Copies parsed fields, interning strings in the pool
+// Children object populated from record
+void Children::setData(const MediaRecord& record) {
+    author = pool->intern(record.author);
+    title = pool->intern(record.title);
+    year = record.year;
+    updateSortKey();
 }
+
 //----------------------------------------------------------------------------
 //Display
 //Format to match sample output: AVAIL TITLE AUTHOR YEAR
 //Note: Children's displays title first, then author (different from fiction)
-void Children::display(ostream& out) const {
-    out << left << setw(6) << copies
-        << setw(40) << title.substr(0, 39)
-        << setw(30) << author.substr(0, 29)
-        << right << setw(5) << year << endl;
+void Children::display(OutputSink& out) const {
+    out.writeLeft(copies, 6)
+       .writeLeft(title.substr(0, 39), 40)
+       .writeLeft(author.substr(0, 29), 30)
+       .writeRight(year, 5) << '\n';
 }
 
 //----------------------------------------------------------------------------
 // operator==
 // Returns true if both are children with same title, author
 bool Children::operator==(const Media& other) const {
-    const Children* c = dynamic_cast<const Children*>(&other);
-    return c && title == c->title && author == c->author;
+    return other.getType() == CHILDREN_CODE && compareTo(other) == 0;
 }
 
 //----------------------------------------------------------------------------
 // operator<
 // Compares children for sorting (author,title,year)
 bool Children::operator<(const Media& other) const {
-    const Children* c = dynamic_cast<const Children*>(&other);
-    if (!c) return false;
+    return other.getType() == CHILDREN_CODE && compareTo(other) < 0;
+}
+
+//----------------------------------------------------------------------------
+// getKey
+// Returns lookup key viewing title and author (valid while this lives)
+MediaKey Children::getKey() const {
+    return MediaKey{CHILDREN_CODE, sortKey, author, title, 0, 0};
+}
+
+//----------------------------------------------------------------------------
+// compareFields
+// Full comparison by title, then author; only reached when sort keys match
+int Children::compareFields(const MediaKey& key) const {
+    if (key.type != CHILDREN_CODE) return 1;
     // Sort by title first, then author
-    if (title != c->title) return title < c->title;
-    return author < c->author;
+    int result = compareStrings(title, key.title);
+    if (result != 0) return result;
+    return compareStrings(author, key.author);
+}
+
+//----------------------------------------------------------------------------
+// makeSortKey
+// Packs title, separator and author prefix into an order-preserving key
+uint64_t Children::makeSortKey(string_view title, string_view author) {
+    return packPrefix(title, author);
+}
+
+//----------------------------------------------------------------------------
+// updateSortKey
+// Recomputes sort key after title or author changes
+void Children::updateSortKey() {
+    sortKey = makeSortKey(title, author);
 }
 
 //----------------------------------------------------------------------------
@@ -67,7 +115,7 @@ bool Children::operator<(const Media& other) const {
 // Factory method to create new Children object
 // Returns pointer to new Children object
 Media* Children::create() const {
-    return new Children();
+    return new Children(pool);
 }
 
 //----------------------------------------------------------------------------
@@ -75,10 +123,11 @@ Media* Children::create() const {
 // Creates deep copy of this children object
 // Returns pointer to new children with same data
 Media* Children::clone() const {
-    Children* c = new Children();
+    Children* c = new Children(pool);
     c->author = this->author;
     c->title = this->title;
     c->year = this->year;
     c->copies = this->copies;
+    c->sortKey = this->sortKey;
     return c;
 }
\ No newline at end of file
@@ -18,8 +18,8 @@ class Children : public Publication {
 public:
     
    
-    // Initializes children's publication with 5 copies
-    Children();
+    // Initializes children's publication with 5 copies, strings interned in pool
+    Children(StringPool* pool = StringPool::getDefault());
     
     // Virtual destructor for proper cleanup
     virtual ~Children();
@@ -27,8 +27,14 @@ public:
     // Reads children's data from input stream (author, title, year)
     virtual void setData(istream& in) override;
 
+    // Reads children's data from a line slice in the same format
+    virtual void setData(string_view data) override;
+
+    // Sets children's data from a parsed record
+    virtual void setData(const MediaRecord& record) override;
+
     // Outputs children's data in formatted columns (title first, then author)
-    virtual void display(ostream& out) const override;
+    virtual void display(OutputSink& out) const override;
  
     // Compares children's publications for equality (same title and author)
     virtual bool operator==(const Media& other) const override;
@@ -36,11 +42,24 @@ public:
     // Compares for sorting by title, then author
     virtual bool operator<(const Media& other) const override;
 
+    // Returns lookup key viewing this book's identity fields
+    virtual MediaKey getKey() const override;
+
+    // Full three-way comparison used when sort keys collide
+    virtual int compareFields(const MediaKey& key) const override;
+
+    // Builds the sort key for a children's book from title and author
+    static uint64_t makeSortKey(string_view title, string_view author);
+
     // Factory method to create new Children object
     virtual Media* create() const override;
     
     // Creates deep copy of this Children object
     virtual Media* clone() const override;
+
+protected:
+    // Recomputes sort key from title then author
+    virtual void updateSortKey() override;
 };
 
 #endif // CHILDREN_H
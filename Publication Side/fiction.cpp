@@ -11,9 +11,9 @@
 */
 
 #include "fiction.h"
-#include <iomanip>
 
 // Constants
+const char FICTION_CODE = 'F';
 const int FICTION_COPIES = 5;
 const int AVAIL_WIDTH = 6;
 const int AUTHOR_WIDTH = 30;
@@ -25,8 +25,8 @@ const int MAX_TITLE_DISPLAY = 39;
 // ----------------------------------------------------------------------------
 // Default Constructor
 // Initializes fiction publication with 5 copies
-// Fiction object created with 5 available copies
-Fiction::Fiction() {
+// Fiction object created with 5 available copies, strings interned in pool
+Fiction::Fiction(StringPool* pool) : Publication(FICTION_CODE, pool) {
     copies = FICTION_COPIES;
 }
 
@@ -40,20 +40,40 @@ Fiction::~Fiction() = default;
 // Reads fiction data from input stream in format: author, title, year
 // Fiction object populated with data from stream
 void Fiction::setData(istream& in) {
-    getline(in >> ws, author, ',');       // Read author until comma
-    getline(in >> ws, title, ',');        // Read title until comma  
+    author = readField(in);               // Read author until comma
+    title = readField(in);                // Read title until comma
     in >> year;                           // Read year as integer
+    updateSortKey();
+}
+
+// ----------------------------------------------------------------------------
+// setData (line slice)
+// Parses "author, title, year" directly from data without a stream
+// Fiction object populated, strings interned in the pool
+void Fiction::setData(string_view data) {
+    setData(MediaRecord::parse(FICTION_CODE, data));
+}
+
+// ----------------------------------------------------------------------------
+// setData (record)
+// Copies parsed fields, interning strings in the pool
+// Fiction object populated from record
+void Fiction::setData(const MediaRecord& record) {
+    author = pool->intern(record.author);
+    title = pool->intern(record.title);
+    year = record.year;
+    updateSortKey();
 }
 
 // ----------------------------------------------------------------------------
 // display
 // Outputs fiction information in formatted columns
-// Fiction data written to stream in tabular format
-void Fiction::display(ostream& out) const {
-    out << left << setw(AVAIL_WIDTH) << copies
-        << setw(AUTHOR_WIDTH) << author.substr(0, MAX_AUTHOR_DISPLAY)
-        << setw(TITLE_WIDTH) << title.substr(0, MAX_TITLE_DISPLAY)
-        << right << setw(YEAR_WIDTH) << year << endl;
+// Fiction data appended to sink in tabular format
+void Fiction::display(OutputSink& out) const {
+    out.writeLeft(copies, AVAIL_WIDTH)
+       .writeLeft(author.substr(0, MAX_AUTHOR_DISPLAY), AUTHOR_WIDTH)
+       .writeLeft(title.substr(0, MAX_TITLE_DISPLAY), TITLE_WIDTH)
+       .writeRight(year, YEAR_WIDTH) << '\n';
 }
 
 // ----------------------------------------------------------------------------
@@ -61,8 +81,7 @@ void Fiction::display(ostream& out) const {
 // Compares two fiction publications for equality
 // Returns true if both are fiction with same author and title
 bool Fiction::operator==(const Media& other) const {
-    const Fiction* f = dynamic_cast<const Fiction*>(&other);
-    return f && author == f->author && title == f->title;
+    return other.getType() == FICTION_CODE && compareTo(other) == 0;
 }
 
 // ----------------------------------------------------------------------------
@@ -70,14 +89,43 @@ bool Fiction::operator==(const Media& other) const {
 // Compares fiction publications for sorting (author first, then title)
 // Returns true if this fiction should sort before other
 bool Fiction::operator<(const Media& other) const {
-    const Fiction* f = dynamic_cast<const Fiction*>(&other);
-    if (!f) return false;
-    
-    // Sort by author first, then by title
-    if (author != f->author) {
-        return author < f->author;
+    return other.getType() == FICTION_CODE && compareTo(other) < 0;
+}
+
+// ----------------------------------------------------------------------------
+// getKey
+// Returns lookup key viewing author and title (valid while this lives)
+MediaKey Fiction::getKey() const {
+    return MediaKey{FICTION_CODE, sortKey, author, title, 0, 0};
+}
+
+// ----------------------------------------------------------------------------
+// compareFields
+// Full comparison by author, then title; only reached when sort keys match
+// Returns negative, zero or positive; non-fiction keys never compare equal
+int Fiction::compareFields(const MediaKey& key) const {
+    if (key.type != FICTION_CODE) return 1;
+
+    int result = compareStrings(author, key.author);
+    if (result != 0) {
+        return result;
     }
-    return title < f->title;
+    return compareStrings(title, key.title);
+}
+
+// ----------------------------------------------------------------------------
+// makeSortKey
+// Packs author, separator and title prefix into an order-preserving key
+// Returns key that orders fiction the same way as operator<
+uint64_t Fiction::makeSortKey(string_view author, string_view title) {
+    return packPrefix(author, title);
+}
+
+// ----------------------------------------------------------------------------
+// updateSortKey
+// Recomputes sort key after author or title changes
+void Fiction::updateSortKey() {
+    sortKey = makeSortKey(author, title);
 }
 
 // ----------------------------------------------------------------------------
@@ -85,7 +133,7 @@ bool Fiction::operator<(const Media& other) const {
 // Factory method to create new Fiction object
 // Returns pointer to new Fiction object
 Media* Fiction::create() const {
-    return new Fiction();
+    return new Fiction(pool);
 }
 
 // ----------------------------------------------------------------------------
@@ -93,10 +141,11 @@ Media* Fiction::create() const {
 // Creates deep copy of this Fiction object
 // Returns pointer to new Fiction with same data
 Media* Fiction::clone() const {
-    Fiction* f = new Fiction();
+    Fiction* f = new Fiction(pool);
     f->author = this->author;
     f->title = this->title;
     f->year = this->year;
     f->copies = this->copies;
+    f->sortKey = this->sortKey;
     return f;
 }
\ No newline at end of file
@@ -17,17 +17,23 @@
 class Fiction : public Publication {
 public:
 
-    // Initializes fiction publication with 5 copies
-    Fiction();
+    // Initializes fiction publication with 5 copies, strings interned in pool
+    Fiction(StringPool* pool = StringPool::getDefault());
     
     // Virtual destructor for proper cleanup
     virtual ~Fiction();
 
     // Reads fiction data from input stream (author, title, year)
     virtual void setData(istream& in) override;
+
+    // Reads fiction data from a line slice in the same format
+    virtual void setData(string_view data) override;
+
+    // Sets fiction data from a parsed record
+    virtual void setData(const MediaRecord& record) override;
     
     // Outputs fiction data in formatted columns
-    virtual void display(ostream& out) const override;
+    virtual void display(OutputSink& out) const override;
 
     // Compares fiction publications for equality (same author and title)
     virtual bool operator==(const Media& other) const override;
@@ -35,11 +41,24 @@ public:
     // Compares for sorting by author, then title
     virtual bool operator<(const Media& other) const override;
 
+    // Returns lookup key viewing this fiction's identity fields
+    virtual MediaKey getKey() const override;
+
+    // Full three-way comparison used when sort keys collide
+    virtual int compareFields(const MediaKey& key) const override;
+
+    // Builds the sort key for a Fiction from its identity fields
+    static uint64_t makeSortKey(string_view author, string_view title);
+
     // Factory method to create new Fiction object
     virtual Media* create() const override;
     
     // Creates deep copy of this Fiction object
     virtual Media* clone() const override;
+
+protected:
+    // Recomputes sort key from author then title
+    virtual void updateSortKey() override;
 };
 
 #endif // FICTION_H
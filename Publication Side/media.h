@@ -6,19 +6,27 @@
 // Author: Sharjeel Khan
 // Assumptions: All media items support data input/output, comparison operations,
 //              and factory methods for creation and cloning
+//              Each concrete type passes a unique type code to the constructor
 // -----------------------------------------------------------------------------
 
 #ifndef MEDIA_H
 #define MEDIA_H
 
+#include "mediaKey.h"
+#include "mediaRecord.h"
+#include "outputSink.h"
+#include "rowCache.h"
+#include <cstdint>
 #include <iostream>
+#include <string_view>
 
 using namespace std;
 
 class Media {
 public:
-    // Creates a media object with default values
-    Media() = default;
+    // Creates a media object tagged with its type code ('F', 'C', 'P')
+    Media(char typeCode)
+        : type(typeCode), rowIndex(0), rowCache(nullptr), sortKey(0) {}
     
     // Ensures proper cleanup of derived classes
     virtual ~Media() = default;
@@ -27,8 +35,17 @@ public:
     // Reads media item data from input stream
     virtual void setData(istream&) = 0;
 
-    // Outputs media item information to output stream
-    virtual void display(ostream& out) const = 0;
+    // Reads media item data from a slice of a line (no stream, no copies)
+    virtual void setData(string_view data) = 0;
+
+    // Sets media item data from fields already parsed into a record
+    virtual void setData(const MediaRecord& record) = 0;
+
+    // Returns record viewing this item's fields (inverse of setData)
+    virtual MediaRecord getRecord() const = 0;
+
+    // Appends media item information to output sink
+    virtual void display(OutputSink& out) const = 0;
 
     // Compares two media items for equality
     virtual bool operator==(const Media& other) const = 0;
@@ -38,6 +55,39 @@ public:
     virtual bool operator<(const Media& other) const = 0;
 
 
+    // Three-way ordering used by the catalog trees: negative, zero or
+    // positive as this sorts before, equal to or after other. Decided by
+    // the precomputed sort keys unless they collide
+    int compareTo(const Media& other) const {
+        if (sortKey != other.sortKey) {
+            return sortKey < other.sortKey ? -1 : 1;
+        }
+        return compareFields(other.getKey());
+    }
+
+    // Same ordering as above against a lookup key
+    int compareTo(const MediaKey& key) const {
+        if (sortKey != key.sortKey) {
+            return sortKey < key.sortKey ? -1 : 1;
+        }
+        return compareFields(key);
+    }
+
+    // Returns type code, lets containers dispatch without RTTI
+    char getType() const { return type; }
+
+    // Returns precomputed sort key; keys order items the same way as <,
+    // equal keys only mean the full fields must be compared
+    uint64_t getSortKey() const { return sortKey; }
+
+    // Returns lookup key viewing this item's identity fields
+    virtual MediaKey getKey() const = 0;
+
+    // Full three-way comparison of identity fields (sort key tiebreak);
+    // keys of another type never compare equal
+    virtual int compareFields(const MediaKey& key) const = 0;
+
+
     // Factory method to create new instance of same media type
     virtual Media* create() const = 0;
     
@@ -48,6 +98,36 @@ public:
 
     // Returns number of available copies of this media item
     virtual int getCopies() const = 0;
+
+    // Sets number of available copies (e.g. restoring saved state)
+    virtual void setCopies(int copies) = 0;
+
+    // Adds one available copy (return)
+    virtual void increaseCopies() = 0;
+
+    // Removes one available copy, never below zero (checkout)
+    virtual void decreaseCopies() = 0;
+
+    // Records the cached display row holding this item's rendered text
+    void attachRow(RowCache* cache, uint32_t row) {
+        rowCache = cache;
+        rowIndex = row;
+    }
+
+private:
+    char type;                        // Type code, fixed at construction
+    uint32_t rowIndex;                // Row within rowCache
+    RowCache* rowCache;               // Cache holding rendered row, if any
+
+protected:
+    uint64_t sortKey;                 // Order-preserving prefix of sort fields
+
+    // Tells the row cache (if any) that displayed fields changed
+    void markRowDirty() {
+        if (rowCache != nullptr) {
+            rowCache->markDirty(rowIndex);
+        }
+    }
 };
 
 #endif // MEDIA_H
\ No newline at end of file
@@ -5,137 +5,300 @@
               binary search trees for Fiction, Children's, and Periodical
               publications with appropriate sorting and display.
  Author: Sharjeel Khan
- Assumptions: BinTree supports insert, retrieve, and display operations
-              Dynamic casting successfully identifies publication types
+ Assumptions: MediaTree backends support insert, retrieve, and display
+              Every Media carries the type code of a registered type
 -----------------------------------------------------------------------------
 */
 
 #include "mediaContainer.h"
-#include "fiction.h"
-#include "children.h"
-#include "periodical.h"
+#include "bintree.h"
+#include "bplustree.h"
+#include <algorithm>
 #include <iostream>
 
 using namespace std;
 
-// Constants for display headers
+// Publication type codes
 const char FICTION_TYPE = 'F';
 const char CHILDREN_TYPE = 'C';
 const char PERIODICAL_TYPE = 'P';
 
+// Registered media types: type code plus the display headers for its
+// section. Adding a media type only needs a row here and a factory case.
+struct MediaTypeEntry {
+    char type;                        // Type code carried by the Media
+    const char* heading;              // Section title
+    const char* columns;              // Column header line
+};
+
+const MediaTypeEntry MEDIA_TYPES[] = {
+    {FICTION_TYPE, "FICTION PUBLICATIONS",
+                   "AVAIL AUTHOR                        TITLE                                    YEAR"},
+    {CHILDREN_TYPE, "CHILDREN'S PUBLICATIONS",
+                    "AVAIL TITLE                                   AUTHOR                         YEAR"},
+    {PERIODICAL_TYPE, "PERIODICAL PUBLICATIONS",
+                      "AVAIL TITLE                                         MONTH YEAR"},
+};
+const int MEDIA_TYPE_COUNT = sizeof(MEDIA_TYPES) / sizeof(MEDIA_TYPES[0]);
+
+// ----------------------------------------------------------------------------
+// findType
+// Looks up registered type entry for a type code
+// Returns entry pointer or nullptr for unregistered codes
+static const MediaTypeEntry* findType(char type) {
+    for (int i = 0; i < MEDIA_TYPE_COUNT; ++i) {
+        if (MEDIA_TYPES[i].type == type) {
+            return &MEDIA_TYPES[i];
+        }
+    }
+    return nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// sortUnique
+// Sorts batch by catalog order, skipping the sort when it is already in
+// order. Equal items keep input order, so the first occurrence stays (as
+// with one-at-a-time insert) and later ones are moved to rejected
+static void sortUnique(vector<Media*>& batch, vector<Media*>& rejected) {
+    bool inOrder = true;
+    for (size_t i = 1; i < batch.size() && inOrder; ++i) {
+        inOrder = batch[i - 1]->compareTo(*batch[i]) <= 0;
+    }
+    if (!inOrder) {
+        stable_sort(batch.begin(), batch.end(), [](const Media* a, const Media* b) {
+            return a->compareTo(*b) < 0;
+        });
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (kept > 0 && batch[kept - 1]->compareTo(*batch[i]) == 0) {
+            rejected.push_back(batch[i]);
+        } else {
+            batch[kept++] = batch[i];
+        }
+    }
+    batch.resize(kept);
+}
+
 // ----------------------------------------------------------------------------
-// Default Constructor
-// Initializes empty binary trees for all publication types
-// MediaContainer created with three empty BinTree objects
-MediaContainer::MediaContainer() = default;
+// Constructor
+// Initializes an empty tree of the chosen backend for every registered type
+// Each tree gets its own arena when useArena is set so one type can be
+// released independently
+MediaContainer::MediaContainer(CatalogBackend backend, bool useArena) {
+    for (int i = 0; i < TYPE_TABLE_SIZE; ++i) {
+        trees[i] = nullptr;
+        rowCaches[i] = nullptr;
+    }
+    for (int i = 0; i < MEDIA_TYPE_COUNT; ++i) {
+        trees[(unsigned char)MEDIA_TYPES[i].type] = createTree(backend, useArena);
+        rowCaches[(unsigned char)MEDIA_TYPES[i].type] = new RowCache();
+    }
+}
 
 // ----------------------------------------------------------------------------
 // Destructor
 // Cleans up all tree resources
-// All BinTree objects properly destroyed
-MediaContainer::~MediaContainer() = default;
+// All tree objects (and the publications they own) and row caches destroyed
+MediaContainer::~MediaContainer() {
+    for (int i = 0; i < TYPE_TABLE_SIZE; ++i) {
+        delete trees[i];
+        delete rowCaches[i];
+    }
+}
+
+// ----------------------------------------------------------------------------
+// createTree
+// Creates an empty tree for the requested backend
+// Returns new tree, BinTree for unrecognized backends
+MediaTree* MediaContainer::createTree(CatalogBackend backend, bool useArena) {
+    switch (backend) {
+        case BPLUS_TREE_BACKEND:
+            return new BPlusTree(useArena);
+        case BINARY_TREE_BACKEND:
+        default:
+            return new BinTree(useArena);
+    }
+}
 
 // ----------------------------------------------------------------------------
 // insert
-// Inserts media item into appropriate tree based on dynamic type
+// Inserts media item into the tree registered for its type code
 // Item inserted into correct tree, returns success status
 bool MediaContainer::insert(Media* item) {
     if (!item) {
         return false;
     }
 
-    // Determine type and insert into appropriate tree
-    if (dynamic_cast<Fiction*>(item)) {
-        return fictionTree.insert(item);
-    } else if (dynamic_cast<Children*>(item)) {
-        return childrenTree.insert(item);
-    } else if (dynamic_cast<Periodical*>(item)) {
-        return periodicalTree.insert(item);
+    MediaTree* tree = getTree(item->getType());
+    if (!tree) {
+        // Fixed: Use cout instead of cerr per assignment requirements
+        cout << "ERROR: Unknown media type. Insert failed." << endl;
+        return false;
     }
 
-    // Fixed: Use cout instead of cerr per assignment requirements
-    cout << "ERROR: Unknown media type. Insert failed." << endl;
-    return false;
+    // Keep hash index in sync with the trees (duplicates never reach it)
+    if (!tree->insert(item)) {
+        return false;
+    }
+    index.insert(item);
+    rowCaches[(unsigned char)item->getType()]->invalidate();
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// bulkLoad
+// Partitions items by type code, sorts and de-duplicates each batch, then
+// builds each empty tree in linear time. Trees that already hold items
+// take the batch one insert at a time instead
+// Stored items indexed, others appended to rejected; returns number stored
+int MediaContainer::bulkLoad(const vector<Media*>& items, vector<Media*>& rejected) {
+    vector<Media*> batches[MEDIA_TYPE_COUNT];
+    for (Media* item : items) {
+        if (!item) {
+            continue;
+        }
+        const MediaTypeEntry* entry = findType(item->getType());
+        if (!entry) {
+            cout << "ERROR: Unknown media type. Insert failed." << endl;
+            rejected.push_back(item);
+            continue;
+        }
+        batches[entry - MEDIA_TYPES].push_back(item);
+    }
+
+    index.reserve(index.size() + items.size());
+    int loaded = 0;
+    for (int t = 0; t < MEDIA_TYPE_COUNT; ++t) {
+        vector<Media*>& batch = batches[t];
+        MediaTree* tree = getTree(MEDIA_TYPES[t].type);
+        sortUnique(batch, rejected);
+        if (!batch.empty()) {
+            rowCaches[(unsigned char)MEDIA_TYPES[t].type]->invalidate();
+        }
+
+        if (tree->buildFromSorted(batch)) {
+            for (Media* item : batch) {
+                index.insert(item);
+            }
+            loaded += (int)batch.size();
+            continue;
+        }
+
+        // Tree already populated - merge the batch item by item
+        for (Media* item : batch) {
+            if (tree->insert(item)) {
+                index.insert(item);
+                loaded++;
+            } else {
+                rejected.push_back(item);
+            }
+        }
+    }
+    return loaded;
 }
 
 // ----------------------------------------------------------------------------
 // retrieve
-// Finds media item in specified tree matching the target
+// Finds media item of specified type matching the target
 // Post: Returns pointer to found item or nullptr if not found
 Media* MediaContainer::retrieve(const Media& target, char type) const {
-    const BinTree* tree = getTree(type);
-    if (!tree) {
+    MediaKey key = target.getKey();
+    if (key.type != type) {
         return nullptr;
     }
-    
-    Media* found = nullptr;
-    tree->retrieve(target, found);
-    return found;
+    return index.retrieve(key);
+}
+
+// ----------------------------------------------------------------------------
+// retrieve (lookup key)
+// Finds media item matching the key's type and fields in the hash index,
+// so lookups cost the same however large the trees grow
+// Post: Returns pointer to found item or nullptr if not found
+Media* MediaContainer::retrieve(const MediaKey& key) const {
+    return index.retrieve(key);
+}
+
+// ----------------------------------------------------------------------------
+// retrieveRange
+// Collects items from specified tree between low and high inclusive
+// Matching items appended to found in sorted order, returns count added
+int MediaContainer::retrieveRange(const Media& low, const Media& high, char type,
+                                  vector<Media*>& found) const {
+    const MediaTree* tree = getTree(type);
+    if (!tree) {
+        return 0;
+    }
+    return tree->retrieveRange(low, high, found);
+}
+
+// ----------------------------------------------------------------------------
+// collectAll
+// Appends contents of every registered tree in registration order
+// Items appended to found, returns count added
+int MediaContainer::collectAll(vector<Media*>& found) const {
+    size_t before = found.size();
+    for (int t = 0; t < MEDIA_TYPE_COUNT; ++t) {
+        getTree(MEDIA_TYPES[t].type)->collectAll(found);
+    }
+    return (int)(found.size() - before);
 }
 
 // ----------------------------------------------------------------------------
 // displayAll
 // Tree contents displayed with headers and formatting
-void MediaContainer::displayAll(char type) const {
-    const BinTree* tree = getTree(type);
+void MediaContainer::displayAll(char type, OutputSink& out) const {
+    const MediaTree* tree = getTree(type);
     if (!tree) {
         return;
     }
     
-    // Display appropriate header based on publication type
-    switch (type) {
-        case FICTION_TYPE:
-            cout << "FICTION PUBLICATIONS" << endl;
-            cout << "AVAIL AUTHOR                        TITLE                                    YEAR" << endl;
-            break;
-        case CHILDREN_TYPE:
-            cout << "CHILDREN'S PUBLICATIONS" << endl;
-            cout << "AVAIL TITLE                                   AUTHOR                         YEAR" << endl;
-            break;
-        case PERIODICAL_TYPE:
-            cout << "PERIODICAL PUBLICATIONS" << endl;
-            cout << "AVAIL TITLE                                         MONTH YEAR" << endl;
-            break;
-        default:
-            cout << "ERROR: Invalid publication type for display." << endl;
-            return;
-    }
+    // Display header registered for this publication type
+    const MediaTypeEntry* entry = findType(type);
+    out << entry->heading << '\n';
+    out << entry->columns << '\n';
     
-    // Display tree contents
-    tree->display();
-    cout << endl; // Add blank line after each section
+    // Display tree contents from the row cache
+    rowCaches[(unsigned char)type]->display(*tree, out);
+    out << '\n'; // Add blank line after each section
+}
+
+// ----------------------------------------------------------------------------
+// getArena
+// Returns arena backing the tree for type code
+// Returns arena pointer, nullptr in heap mode or for invalid type
+Arena* MediaContainer::getArena(char type) const {
+    const MediaTree* tree = getTree(type);
+    return tree ? tree->getArena() : nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// getStringPool
+// Returns pool shared by all publications in this container
+StringPool* MediaContainer::getStringPool() {
+    return &pool;
+}
+
+// ----------------------------------------------------------------------------
+// getStringPool (const version)
+// Returns const pointer to pool for reporting statistics
+const StringPool* MediaContainer::getStringPool() const {
+    return &pool;
 }
 
 // ----------------------------------------------------------------------------
 // getTree
-// Returns pointer to tree corresponding to type code
+// Returns pointer to tree registered for type code
 // Returns pointer to appropriate tree or nullptr for invalid type
-BinTree* MediaContainer::getTree(char type) {
-    switch (type) {
-        case FICTION_TYPE: 
-            return &fictionTree;
-        case CHILDREN_TYPE: 
-            return &childrenTree;
-        case PERIODICAL_TYPE: 
-            return &periodicalTree;
-        default: 
-            return nullptr;
-    }
+MediaTree* MediaContainer::getTree(char type) {
+    return trees[(unsigned char)type];
 }
 
 // ----------------------------------------------------------------------------
 // getTree (const version)
-// Returns const pointer to tree corresponding to type code
+// Returns const pointer to tree registered for type code
 // Returns const pointer to appropriate tree or nullptr for invalid type
-const BinTree* MediaContainer::getTree(char type) const {
-    switch (type) {
-        case FICTION_TYPE: 
-            return &fictionTree;
-        case CHILDREN_TYPE: 
-            return &childrenTree;
-        case PERIODICAL_TYPE: 
-            return &periodicalTree;
-        default: 
-            return nullptr;
-    }
-}
\ No newline at end of file
+const MediaTree* MediaContainer::getTree(char type) const {
+    return trees[(unsigned char)type];
+}
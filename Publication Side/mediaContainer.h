@@ -1,26 +1,42 @@
 /*
 -----------------------------------------------------------------------------
  File: mediaContainer.h
- Description: Manages multiple BinTree containers for different media types.
+ Description: Manages multiple sorted containers for different media types.
               Provides unified interface for storing Fiction, Children's, and
-              Periodical publications in separate sorted collections.
+              Periodical publications in separate sorted collections. The
+              collections are BinTree (AVL) or BPlusTree, picked at
+              construction, optionally each backed by its own arena.
+              A hash index over all types answers exact-match lookups.
+              Publications intern their strings in the container's pool.
  Author: Sharjeel Khan
- Assumptions: BinTree class exists and supports Media storage
-              Media types can be determined via dynamic_cast
+ Assumptions: MediaTree implementations support Media storage
+              Trees are selected by each Media's type code through a
+              dispatch table; new media types register in MEDIA_TYPES
 -----------------------------------------------------------------------------
 */
 
 #ifndef MEDIACONTAINER_H
 #define MEDIACONTAINER_H
 
-#include "bintree.h"
+#include "mediaTree.h"
+#include "mediaHash.h"
+#include "stringPool.h"
+#include "rowCache.h"
 #include "media.h"
+#include <vector>
+
+// Storage used for each publication collection
+enum CatalogBackend {
+    BINARY_TREE_BACKEND,              // Balanced binary search tree (BinTree)
+    BPLUS_TREE_BACKEND                // Wide-node B+ tree with linked leaves
+};
 
 class MediaContainer {
 public:
 
     // Initializes empty containers for all media types
-    MediaContainer();
+    MediaContainer(CatalogBackend backend = BINARY_TREE_BACKEND,
+                   bool useArena = false);
     
 
     // Cleans up all container resources
@@ -28,27 +44,64 @@ public:
     
     // Inserts media item into appropriate container based on type
     bool insert(Media* item); 
+
+    // Inserts a batch of items, building empty trees directly from sorted
+    // input; items not stored (duplicates, unknown types) are appended to
+    // rejected for the caller to dispose of. Returns number stored
+    int bulkLoad(const vector<Media*>& items, vector<Media*>& rejected);
     
 
     // Finds and returns media item matching target in specified container
     Media* retrieve(const Media& target, char type) const;
+
+    // Finds and returns media item matching lookup key (no allocation),
+    // answered from the hash index
+    Media* retrieve(const MediaKey& key) const;
+
+    // Collects items between low and high (inclusive) in sorted order
+    int retrieveRange(const Media& low, const Media& high, char type,
+                      vector<Media*>& found) const;
     
 
-    // Displays all items in specified container with headers
-    void displayAll(char type) const;
+    // Appends every item to found, one type after another, each in sorted
+    // order; returns number appended
+    int collectAll(vector<Media*>& found) const;
+
+    // Appends all items in specified container with headers to out; rows
+    // come from the type's row cache, re-rendering only changed items
+    void displayAll(char type, OutputSink& out) const;
+
+    // Returns arena new items of given type should be allocated from,
+    // nullptr in heap mode or for invalid type
+    Arena* getArena(char type) const;
+
+    // Returns pool new items should intern their strings in
+    StringPool* getStringPool();
+    const StringPool* getStringPool() const;
 
 private:
-    BinTree fictionTree;              // Container for Fiction publications
-    BinTree childrenTree;             // Container for Children's publications
-    BinTree periodicalTree;           // Container for Periodical publications
+    static const int TYPE_TABLE_SIZE = 256;   // One slot per char type code
+
+    MediaTree* trees[TYPE_TABLE_SIZE];  // Tree per registered type code,
+                                        // nullptr for unregistered codes
+    RowCache* rowCaches[TYPE_TABLE_SIZE];  // Rendered rows for each tree,
+                                           // nullptr where trees is
+    MediaHash index;                  // Exact-match index over all trees
+    StringPool pool;                  // Authors and titles shared by all types
+
+    // Containers own their trees, copying is not supported
+    MediaContainer(const MediaContainer&) = delete;
+    MediaContainer& operator=(const MediaContainer&) = delete;
 
+    // Creates an empty tree of the requested backend
+    static MediaTree* createTree(CatalogBackend backend, bool useArena);
 
     // Returns pointer to appropriate tree based on type code
-    BinTree* getTree(char type);
+    MediaTree* getTree(char type);
     
  
     // Returns const pointer to appropriate tree based on type code
-    const BinTree* getTree(char type) const;
+    const MediaTree* getTree(char type) const;
 };
 
 #endif // MEDIACONTAINER_H
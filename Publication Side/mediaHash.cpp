@@ -0,0 +1,169 @@
+/*
+-----------------------------------------------------------------------------
+ File: mediaHash.cpp
+ Description: Implementation of MediaHash index. Each slot caches the full
+              64-bit hash so probes only compare fields when hashes match.
+ Author: Sharjeel Khan
+ Assumptions: Load factor is kept at or below 1/2 so probe runs stay short
+-----------------------------------------------------------------------------
+*/
+
+#include "mediaHash.h"
+#include <cstring>
+
+using namespace std;
+
+// Constants
+const uint64_t HASH_SEED = 0x9E3779B97F4A7C15ULL;
+const uint64_t HASH_MULTIPLIER = 0xFF51AFD7ED558CCDULL;
+
+// ----------------------------------------------------------------------------
+// mix
+// Folds value into running hash and scrambles the bits
+static uint64_t mix(uint64_t hash, uint64_t value) {
+    hash ^= value;
+    hash *= HASH_MULTIPLIER;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// ----------------------------------------------------------------------------
+// mixString
+// Folds string bytes into running hash eight bytes at a time
+static uint64_t mixString(uint64_t hash, string_view text) {
+    size_t i = 0;
+    for (; i + 8 <= text.size(); i += 8) {
+        uint64_t chunk;
+        memcpy(&chunk, text.data() + i, 8);
+        hash = mix(hash, chunk);
+    }
+    uint64_t tail = 0;
+    if (i < text.size()) {
+        memcpy(&tail, text.data() + i, text.size() - i);
+    }
+    return mix(hash, tail ^ ((uint64_t)text.size() << 56));
+}
+
+// ----------------------------------------------------------------------------
+// Default Constructor
+// Initializes empty index with a small slot array
+MediaHash::MediaHash()
+    : slots(new Slot[INITIAL_CAPACITY]()), capacity(INITIAL_CAPACITY), count(0) {
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Frees slot array, Media objects are owned by the trees
+MediaHash::~MediaHash() {
+    delete[] slots;
+}
+
+// ----------------------------------------------------------------------------
+// hashKey
+// Hashes type code and identity fields of a lookup key
+// Returns 64-bit hash, equal keys always hash equal
+uint64_t MediaHash::hashKey(const MediaKey& key) {
+    uint64_t hash = mix(HASH_SEED, (uint64_t)(unsigned char)key.type);
+    hash = mixString(hash, key.author);
+    hash = mixString(hash, key.title);
+    hash = mix(hash, ((uint64_t)(uint32_t)key.year << 32) | (uint32_t)key.month);
+    return hash;
+}
+
+// ----------------------------------------------------------------------------
+// hashString
+// Hashes string bytes and length
+// Returns 64-bit hash, equal strings always hash equal
+uint64_t MediaHash::hashString(string_view text) {
+    return mixString(HASH_SEED, text);
+}
+
+// ----------------------------------------------------------------------------
+// insert
+// Adds Media to the index, growing first if it would pass half full
+void MediaHash::insert(Media* media) {
+    if (media == nullptr) {
+        return;
+    }
+    if ((count + 1) * 2 > capacity) {
+        rehash(capacity * 2);
+    }
+    place(hashKey(media->getKey()), media);
+    count++;
+}
+
+// ----------------------------------------------------------------------------
+// retrieve
+// Probes from the key's home slot until a match or an empty slot
+// Returns matching Media or nullptr
+Media* MediaHash::retrieve(const MediaKey& key) const {
+    uint64_t hash = hashKey(key);
+    size_t mask = capacity - 1;
+    for (size_t i = hash & mask; slots[i].media != nullptr; i = (i + 1) & mask) {
+        if (slots[i].hash == hash && slots[i].media->compareTo(key) == 0) {
+            return slots[i].media;
+        }
+    }
+    return nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// reserve
+// Sizes table (power of two, at most half full) for expected entries in
+// one rehash instead of repeated doubling
+void MediaHash::reserve(size_t expected) {
+    size_t newCapacity = capacity;
+    while (expected * 2 > newCapacity) {
+        newCapacity *= 2;
+    }
+    if (newCapacity != capacity) {
+        rehash(newCapacity);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// clear
+// Removes all entries, keeping the current slot array
+void MediaHash::clear() {
+    for (size_t i = 0; i < capacity; ++i) {
+        slots[i].media = nullptr;
+    }
+    count = 0;
+}
+
+// ----------------------------------------------------------------------------
+// size
+// Returns number of indexed Media
+size_t MediaHash::size() const {
+    return count;
+}
+
+// ----------------------------------------------------------------------------
+// rehash
+// Replaces slot array and reinserts entries using their cached hashes
+void MediaHash::rehash(size_t newCapacity) {
+    Slot* oldSlots = slots;
+    size_t oldCapacity = capacity;
+
+    capacity = newCapacity;
+    slots = new Slot[capacity]();
+    for (size_t i = 0; i < oldCapacity; ++i) {
+        if (oldSlots[i].media != nullptr) {
+            place(oldSlots[i].hash, oldSlots[i].media);
+        }
+    }
+    delete[] oldSlots;
+}
+
+// ----------------------------------------------------------------------------
+// place
+// Stores entry in the first empty slot from its home position
+void MediaHash::place(uint64_t hash, Media* media) {
+    size_t mask = capacity - 1;
+    size_t i = hash & mask;
+    while (slots[i].media != nullptr) {
+        i = (i + 1) & mask;
+    }
+    slots[i].hash = hash;
+    slots[i].media = media;
+}
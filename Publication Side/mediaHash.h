@@ -0,0 +1,76 @@
+/*
+-----------------------------------------------------------------------------
+ File: mediaHash.h
+ Description: Hash index of Media pointers keyed by type code and identity
+              fields. Gives O(1) exact-match lookup for checkouts and
+              returns alongside the sorted trees, which stay responsible
+              for ordered display and range scans. Uses open addressing
+              with linear probing in a power-of-two table that doubles
+              when it gets too full.
+ Author: Sharjeel Khan
+ Assumptions: Index does not own the Media it points to
+              Media inserted are not duplicates (trees reject those first)
+-----------------------------------------------------------------------------
+*/
+
+#ifndef MEDIAHASH_H
+#define MEDIAHASH_H
+
+#include "media.h"
+#include "mediaKey.h"
+#include <cstddef>
+#include <cstdint>
+
+class MediaHash {
+public:
+    // Creates empty index
+    MediaHash();
+
+    // Frees the slot array (not the Media)
+    ~MediaHash();
+
+    // Adds Media to the index
+    void insert(Media* media);
+
+    // Finds Media matching lookup key, nullptr if absent
+    Media* retrieve(const MediaKey& key) const;
+
+    // Grows table ahead of time so expected entries fit without rehashing
+    void reserve(size_t expected);
+
+    // Removes all entries
+    void clear();
+
+    // Returns number of indexed Media
+    size_t size() const;
+
+    // Computes hash of a lookup key's type and identity fields
+    static uint64_t hashKey(const MediaKey& key);
+
+    // Computes hash of a string (shared with StringPool)
+    static uint64_t hashString(string_view text);
+
+private:
+    struct Slot {
+        uint64_t hash;                // Cached hash of the item's key
+        Media* media;                 // Indexed item, nullptr if empty
+    };
+
+    static const size_t INITIAL_CAPACITY = 64;  // Must be a power of two
+
+    Slot* slots;                      // Open-addressed slot array
+    size_t capacity;                  // Number of slots (power of two)
+    size_t count;                     // Number of occupied slots
+
+    // Moves every entry into a new slot array of newCapacity slots
+    void rehash(size_t newCapacity);
+
+    // Places entry in first free slot of its probe sequence
+    void place(uint64_t hash, Media* media);
+
+    // Index owns its slot array, copying is not supported
+    MediaHash(const MediaHash&) = delete;
+    MediaHash& operator=(const MediaHash&) = delete;
+};
+
+#endif // MEDIAHASH_H
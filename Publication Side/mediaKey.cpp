@@ -0,0 +1,85 @@
+/*
+-----------------------------------------------------------------------------
+ File: mediaKey.cpp
+ Description: Implementation of MediaKey builders. Sort keys come from the
+              publication classes so keys and stored items always agree.
+              Command fields are sliced in place, never copied.
+ Author: Sharjeel Khan
+ Assumptions: Command publication fields are comma terminated
+-----------------------------------------------------------------------------
+*/
+
+#include "mediaKey.h"
+#include "fiction.h"
+#include "children.h"
+#include "periodical.h"
+#include "textScanner.h"
+
+using namespace std;
+
+// Constants for publication type codes
+const char FICTION_CODE = 'F';
+const char CHILDREN_CODE = 'C';
+const char PERIODICAL_CODE = 'P';
+const int UNUSED_FIELD = 0;
+
+// ----------------------------------------------------------------------------
+// fiction
+// Builds fiction lookup key sorted by author then title
+MediaKey MediaKey::fiction(string_view author, string_view title) {
+    return MediaKey{FICTION_CODE, Fiction::makeSortKey(author, title),
+                    author, title, UNUSED_FIELD, UNUSED_FIELD};
+}
+
+// ----------------------------------------------------------------------------
+// children
+// Builds children's lookup key sorted by title then author
+MediaKey MediaKey::children(string_view title, string_view author) {
+    return MediaKey{CHILDREN_CODE, Children::makeSortKey(title, author),
+                    author, title, UNUSED_FIELD, UNUSED_FIELD};
+}
+
+// ----------------------------------------------------------------------------
+// periodical
+// Builds periodical lookup key sorted by year, month, then title
+MediaKey MediaKey::periodical(int year, int month, string_view title) {
+    return MediaKey{PERIODICAL_CODE, Periodical::makeSortKey(year, month, title),
+                    string_view(), title, month, year};
+}
+
+// ----------------------------------------------------------------------------
+// fromCommand
+// Slices command publication fields into a lookup key, matching how the
+// data file parsers would read the same fields
+// Returns true and fills key for valid types, false otherwise
+bool MediaKey::fromCommand(char type, string_view data, MediaKey& key) {
+    switch (type) {
+        case FICTION_CODE: {
+            TextScanner::skipSpace(data);
+            string_view author = TextScanner::takeField(data);
+            TextScanner::skipSpace(data);
+            string_view title = TextScanner::takeField(data);
+            key = fiction(author, title);
+            return true;
+        }
+        case CHILDREN_CODE: {
+            TextScanner::skipSpace(data);
+            string_view title = TextScanner::takeField(data);
+            TextScanner::skipSpace(data);
+            string_view author = TextScanner::takeField(data);
+            key = children(title, author);
+            return true;
+        }
+        case PERIODICAL_CODE: {
+            int year, month;
+            TextScanner::takeInt(data, year);
+            TextScanner::takeInt(data, month);
+            TextScanner::skipSpace(data);
+            string_view title = TextScanner::takeField(data);
+            key = periodical(year, month, title);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
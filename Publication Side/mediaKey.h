@@ -0,0 +1,45 @@
+/*
+-----------------------------------------------------------------------------
+ File: mediaKey.h
+ Description: Lightweight lookup key for catalog searches. Holds the type
+              code, precomputed sort key and string_view identity fields of
+              a publication, so a search can be described without building
+              (and heap allocating) a dummy Media object.
+ Author: Sharjeel Khan
+ Assumptions: Viewed strings outlive the key
+              Type codes 'F', 'C', 'P' map to Fiction, Children, Periodical
+-----------------------------------------------------------------------------
+*/
+
+#ifndef MEDIAKEY_H
+#define MEDIAKEY_H
+
+#include <cstdint>
+#include <string_view>
+
+using namespace std;
+
+struct MediaKey {
+    char type;                        // Publication type code
+    uint64_t sortKey;                 // Same key the matching Media carries
+    string_view author;               // Author (empty for periodicals)
+    string_view title;                // Title
+    int month;                        // Month (periodicals only)
+    int year;                         // Year (periodicals only)
+
+    // Builds key for a fiction lookup by (author, title)
+    static MediaKey fiction(string_view author, string_view title);
+
+    // Builds key for a children's lookup by (title, author)
+    static MediaKey children(string_view title, string_view author);
+
+    // Builds key for a periodical lookup by (year, month, title)
+    static MediaKey periodical(int year, int month, string_view title);
+
+    // Builds key from the publication fields of a checkout/return command:
+    // "author, title," (F), "title, author," (C), "year month title," (P)
+    // Returns false for an unknown publication type
+    static bool fromCommand(char type, string_view data, MediaKey& key);
+};
+
+#endif // MEDIAKEY_H
@@ -0,0 +1,58 @@
+/*
+-----------------------------------------------------------------------------
+ File: mediaRecord.cpp
+ Description: Implementation of MediaRecord parsing. Uses the same field
+              rules as the stream parsers: leading whitespace skipped,
+              text fields end at a comma, numbers parsed in place.
+ Author: Sharjeel Khan
+ Assumptions: Type codes 'F', 'C', 'P' map to Fiction, Children, Periodical
+-----------------------------------------------------------------------------
+*/
+
+#include "mediaRecord.h"
+#include "textScanner.h"
+
+using namespace std;
+
+// Constants for publication type codes
+const char FICTION_CODE = 'F';
+const char CHILDREN_CODE = 'C';
+const char PERIODICAL_CODE = 'P';
+const int UNUSED_FIELD = 0;
+const size_t DATA_OFFSET = 2;         // Fields start after type and space
+
+// ----------------------------------------------------------------------------
+// parse
+// Slices author/title fields and parses numbers for the given type
+// Returns record; fields left empty/zero for unknown types
+MediaRecord MediaRecord::parse(char type, string_view data) {
+    MediaRecord record{type, string_view(), string_view(), UNUSED_FIELD, UNUSED_FIELD};
+    switch (type) {
+        case FICTION_CODE:
+        case CHILDREN_CODE:
+            TextScanner::skipSpace(data);
+            record.author = TextScanner::takeField(data);
+            TextScanner::skipSpace(data);
+            record.title = TextScanner::takeField(data);
+            TextScanner::takeInt(data, record.year);
+            break;
+        case PERIODICAL_CODE:
+            TextScanner::skipSpace(data);
+            record.title = TextScanner::takeField(data);
+            TextScanner::takeInt(data, record.month);
+            TextScanner::takeInt(data, record.year);
+            break;
+        default:
+            break;
+    }
+    return record;
+}
+
+// ----------------------------------------------------------------------------
+// fromLine
+// Splits type code from the fields of a non-empty data line
+// Returns parsed record
+MediaRecord MediaRecord::fromLine(string_view line) {
+    string_view data = line.size() > DATA_OFFSET ? line.substr(DATA_OFFSET) : string_view();
+    return parse(line.empty() ? '\0' : line[0], data);
+}
@@ -0,0 +1,38 @@
+/*
+-----------------------------------------------------------------------------
+ File: mediaRecord.h
+ Description: Parsed fields of one publication data line, as string_view
+              slices of the line plus its numbers. Parsing a line into a
+              record touches no shared state, so loader threads can parse
+              chunks of a file in parallel and leave building publications
+              (interning, arena allocation) to a single merging thread.
+ Author: Sharjeel Khan
+ Assumptions: Viewed strings outlive the record
+              Line format is "F author, title, year", "C author, title,
+              year" or "P title, month year"
+-----------------------------------------------------------------------------
+*/
+
+#ifndef MEDIARECORD_H
+#define MEDIARECORD_H
+
+#include <string_view>
+
+using namespace std;
+
+struct MediaRecord {
+    char type;                        // Publication type code
+    string_view author;               // Author (empty for periodicals)
+    string_view title;                // Title
+    int month;                        // Month (periodicals only)
+    int year;                         // Year
+
+    // Parses the fields that follow the type code for a publication of
+    // the given type; unknown types leave every field empty
+    static MediaRecord parse(char type, string_view data);
+
+    // Parses a whole data file line: type code, a space, then the fields
+    static MediaRecord fromLine(string_view line);
+};
+
+#endif // MEDIARECORD_H
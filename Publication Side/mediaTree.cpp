@@ -0,0 +1,32 @@
+/*
+-----------------------------------------------------------------------------
+ File: mediaTree.cpp
+ Description: Implementation of the MediaTree base class. Owns the optional
+              arena shared by a collection's nodes and the Media it holds.
+ Author: Sharjeel Khan
+ Assumptions: Derived destructors empty the collection before the arena
+              is destroyed
+-----------------------------------------------------------------------------
+*/
+
+#include "mediaTree.h"
+
+// ----------------------------------------------------------------------------
+// Constructor
+// Creates empty collection, with a private arena when useArena is set
+MediaTree::MediaTree(bool useArena) : arena(useArena ? new Arena() : nullptr) {
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Frees the arena and everything still allocated in it
+MediaTree::~MediaTree() {
+    delete arena;
+}
+
+// ----------------------------------------------------------------------------
+// getArena
+// Returns arena used for nodes and Media, nullptr in heap mode
+Arena* MediaTree::getArena() const {
+    return arena;
+}
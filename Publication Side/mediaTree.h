@@ -0,0 +1,71 @@
+/*
+-----------------------------------------------------------------------------
+ File: mediaTree.h
+ Description: Abstract interface for sorted Media collections. Lets
+              MediaContainer swap between catalog backends (BinTree,
+              BPlusTree) without changing how publications are stored,
+              found, or displayed.
+ Author: Sharjeel Khan
+ Assumptions: Media objects have properly implemented < and == operators
+              Each collection holds a single media type
+              In arena mode, all inserted Media were allocated from the
+              collection's own arena
+-----------------------------------------------------------------------------
+*/
+
+#ifndef MEDIATREE_H
+#define MEDIATREE_H
+
+#include "media.h"
+#include "arena.h"
+#include <vector>
+
+using namespace std;
+
+class MediaTree {
+public:
+    // Creates empty collection, optionally backed by its own arena
+    MediaTree(bool useArena = false);
+
+    // Ensures proper cleanup of derived collections, frees the arena
+    virtual ~MediaTree();
+
+    // Inserts Media pointer in sorted order, rejects duplicates
+    virtual bool insert(Media* media) = 0;
+
+    // Builds an empty collection in linear time from items in strictly
+    // ascending order; returns false (taking nothing) if not empty
+    virtual bool buildFromSorted(const vector<Media*>& sorted) = 0;
+
+    // Finds Media object matching target
+    virtual bool retrieve(const Media& target, Media*& found) const = 0;
+
+    // Finds Media object matching lookup key without building a target
+    virtual bool retrieve(const MediaKey& key, Media*& found) const = 0;
+
+    // Appends all Media objects in [low, high] to found in sorted order
+    virtual int retrieveRange(const Media& low, const Media& high,
+                              vector<Media*>& found) const = 0;
+
+    // Appends every Media object to found in sorted order
+    virtual void collectAll(vector<Media*>& found) const = 0;
+
+    // Appends all Media objects to out in sorted order
+    virtual void display(OutputSink& out) const = 0;
+
+    // Removes all entries from the collection
+    virtual void makeEmpty() = 0;
+
+    // Returns arena that nodes and Media live in, nullptr for heap mode
+    Arena* getArena() const;
+
+protected:
+    Arena* arena;                     // Slab storage for a catalog generation
+
+private:
+    // Collections own their nodes, copying is not supported
+    MediaTree(const MediaTree&) = delete;
+    MediaTree& operator=(const MediaTree&) = delete;
+};
+
+#endif // MEDIATREE_H
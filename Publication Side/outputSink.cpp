@@ -0,0 +1,193 @@
+/*
+-----------------------------------------------------------------------------
+ File: outputSink.cpp
+ Description: Implementation of OutputSink. Text is copied into a fixed
+              buffer that is drained to the stream when full; numbers are
+              formatted in place with to_chars.
+ Author: Sharjeel Khan
+ Assumptions: Default stream formatting (decimal, precision 6) is what the
+              replaced ostream output used
+-----------------------------------------------------------------------------
+*/
+
+#include "outputSink.h"
+#include <charconv>
+#include <algorithm>
+#include <cstring>
+
+// Constants
+const int NUMBER_BUFFER_SIZE = 32;    // Fits any 64-bit integer or %g double
+const int DOUBLE_PRECISION = 6;       // Default ostream precision
+
+// ----------------------------------------------------------------------------
+// Constructor
+// Sets up an empty buffer in front of the stream, large enough for any
+// single formatted number
+OutputSink::OutputSink(ostream& out, size_t capacity)
+    : out(out), buffer(max(capacity, (size_t)NUMBER_BUFFER_SIZE)), used(0),
+      drained(0) {
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Hands remaining text to the stream
+OutputSink::~OutputSink() {
+    flush();
+}
+
+// ----------------------------------------------------------------------------
+// operator<< (text)
+// Copies text into the buffer; text longer than the buffer goes straight
+// to the stream after draining
+OutputSink& OutputSink::operator<<(string_view text) {
+    char* room = reserve(text.size());
+    if (room == nullptr) {
+        out.write(text.data(), text.size());
+        drained += text.size();
+        return *this;
+    }
+    if (!text.empty()) {
+        memcpy(room, text.data(), text.size());
+    }
+    used += text.size();
+    return *this;
+}
+
+// ----------------------------------------------------------------------------
+// operator<< (character)
+OutputSink& OutputSink::operator<<(char c) {
+    *reserve(1) = c;
+    ++used;
+    return *this;
+}
+
+// ----------------------------------------------------------------------------
+// appendInteger
+// Formats value straight into the buffer
+template <typename T>
+OutputSink& OutputSink::appendInteger(T value) {
+    char* room = reserve(NUMBER_BUFFER_SIZE);
+    used = to_chars(room, room + NUMBER_BUFFER_SIZE, value).ptr - buffer.data();
+    return *this;
+}
+
+// ----------------------------------------------------------------------------
+// operator<< (integers)
+// All integer widths share the to_chars formatter
+OutputSink& OutputSink::operator<<(int value) {
+    return appendInteger(value);
+}
+
+OutputSink& OutputSink::operator<<(long value) {
+    return appendInteger(value);
+}
+
+OutputSink& OutputSink::operator<<(long long value) {
+    return appendInteger(value);
+}
+
+OutputSink& OutputSink::operator<<(unsigned value) {
+    return appendInteger(value);
+}
+
+OutputSink& OutputSink::operator<<(unsigned long value) {
+    return appendInteger(value);
+}
+
+OutputSink& OutputSink::operator<<(unsigned long long value) {
+    return appendInteger(value);
+}
+
+// ----------------------------------------------------------------------------
+// operator<< (double)
+// General format with six significant digits, as ostream prints by default
+OutputSink& OutputSink::operator<<(double value) {
+    char* room = reserve(NUMBER_BUFFER_SIZE);
+    used = to_chars(room, room + NUMBER_BUFFER_SIZE, value,
+                    chars_format::general, DOUBLE_PRECISION).ptr - buffer.data();
+    return *this;
+}
+
+// ----------------------------------------------------------------------------
+// writeLeft (text)
+// Text followed by padding up to width
+OutputSink& OutputSink::writeLeft(string_view text, int width) {
+    *this << text;
+    return fill(' ', width - (int)text.size());
+}
+
+// ----------------------------------------------------------------------------
+// writeLeft (integer)
+OutputSink& OutputSink::writeLeft(long long value, int width) {
+    char digits[NUMBER_BUFFER_SIZE];
+    char* end = to_chars(digits, digits + NUMBER_BUFFER_SIZE, value).ptr;
+    return writeLeft(string_view(digits, end - digits), width);
+}
+
+// ----------------------------------------------------------------------------
+// writeRight (text)
+// Padding up to width followed by text
+OutputSink& OutputSink::writeRight(string_view text, int width) {
+    fill(' ', width - (int)text.size());
+    return *this << text;
+}
+
+// ----------------------------------------------------------------------------
+// writeRight (integer)
+OutputSink& OutputSink::writeRight(long long value, int width) {
+    char digits[NUMBER_BUFFER_SIZE];
+    char* end = to_chars(digits, digits + NUMBER_BUFFER_SIZE, value).ptr;
+    return writeRight(string_view(digits, end - digits), width);
+}
+
+// ----------------------------------------------------------------------------
+// fill
+// Appends count copies of c, nothing if count is not positive
+OutputSink& OutputSink::fill(char c, int count) {
+    while (count > 0) {
+        size_t chunk = min((size_t)count, buffer.size());
+        memset(reserve(chunk), c, chunk);
+        used += chunk;
+        count -= (int)chunk;
+    }
+    return *this;
+}
+
+// ----------------------------------------------------------------------------
+// flush
+// Buffered text written and stream flushed
+void OutputSink::flush() {
+    drain();
+    out.flush();
+}
+
+// ----------------------------------------------------------------------------
+// getWritten
+// Returns bytes drained plus bytes still buffered
+size_t OutputSink::getWritten() const {
+    return drained + used;
+}
+
+// ----------------------------------------------------------------------------
+// drain
+// Buffered text written, buffer emptied
+void OutputSink::drain() {
+    if (used > 0) {
+        out.write(buffer.data(), used);
+        drained += used;
+        used = 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// reserve
+// Returns room for n bytes at the end of the buffer
+char* OutputSink::reserve(size_t n) {
+    if (n > buffer.size() - used) {
+        drain();
+        if (n > buffer.size()) {
+            return nullptr;
+        }
+    }
+    return buffer.data() + used;
+}
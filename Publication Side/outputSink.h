@@ -0,0 +1,89 @@
+/*
+-----------------------------------------------------------------------------
+ File: outputSink.h
+ Description: Buffered text output for display paths. Rows are appended to
+              a large in-memory buffer, integers are formatted with
+              to_chars, and the buffer is handed to the underlying stream
+              only when it fills or when the owner calls flush(), so a full
+              catalog listing costs a few writes instead of one per line.
+              Field helpers mirror the left/right << setw formatting the
+              display code used before, keeping output byte-identical.
+ Author: Sharjeel Khan
+ Assumptions: The stream outlives the sink
+              Callers flush at the end of each command; the destructor
+              flushes anything left over
+-----------------------------------------------------------------------------
+*/
+
+#ifndef OUTPUTSINK_H
+#define OUTPUTSINK_H
+
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+class OutputSink {
+public:
+    static const size_t DEFAULT_CAPACITY = 64 * 1024;
+
+    // Creates sink writing to out through a buffer of capacity bytes
+    explicit OutputSink(ostream& out = cout, size_t capacity = DEFAULT_CAPACITY);
+
+    // Flushes any buffered text
+    ~OutputSink();
+
+    // Appends text, characters and numbers (same text as ostream <<)
+    OutputSink& operator<<(string_view text);
+    OutputSink& operator<<(char c);
+    OutputSink& operator<<(int value);
+    OutputSink& operator<<(long value);
+    OutputSink& operator<<(long long value);
+    OutputSink& operator<<(unsigned value);
+    OutputSink& operator<<(unsigned long value);
+    OutputSink& operator<<(unsigned long long value);
+    OutputSink& operator<<(double value);
+
+    // Appends value left-aligned and space-padded to width
+    // (same as left << setw(width) << value)
+    OutputSink& writeLeft(string_view text, int width);
+    OutputSink& writeLeft(long long value, int width);
+
+    // Appends value right-aligned and space-padded to width
+    // (same as right << setw(width) << value)
+    OutputSink& writeRight(string_view text, int width);
+    OutputSink& writeRight(long long value, int width);
+
+    // Appends count copies of c
+    OutputSink& fill(char c, int count);
+
+    // Writes buffered text to the stream and flushes the stream
+    void flush();
+
+    // Returns total bytes appended since construction
+    size_t getWritten() const;
+
+private:
+    ostream& out;                     // Destination stream
+    vector<char> buffer;              // Pending text, size is capacity
+    size_t used;                      // Bytes of buffer holding text
+    size_t drained;                   // Bytes already handed to the stream
+
+    // Writes buffered text to the stream without flushing it
+    void drain();
+
+    // Returns pointer to room for n more bytes, draining first if needed;
+    // nullptr if n is larger than the whole buffer
+    char* reserve(size_t n);
+
+    // Formats integer into buffer with to_chars
+    template <typename T>
+    OutputSink& appendInteger(T value);
+
+    // Sinks hold a reference to their stream, copying is not supported
+    OutputSink(const OutputSink&) = delete;
+    OutputSink& operator=(const OutputSink&) = delete;
+};
+
+#endif // OUTPUTSINK_H
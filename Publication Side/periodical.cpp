@@ -10,9 +10,9 @@
 -----------------------------------------------------------------------------
 */
 #include "periodical.h"
-#include <iomanip>
 
 // Constants  
+const char PERIODICAL_CODE = 'P';
 const int PERIODICAL_COPIES = 1;
 const int AVAIL_WIDTH = 6;
 const int TITLE_WIDTH = 40;
@@ -20,12 +20,17 @@ const int MONTH_WIDTH = 8;
 const int YEAR_WIDTH = 6;
 const int MAX_TITLE_DISPLAY = 39;
 const int DEFAULT_MONTH = 0;
+const int MAX_KEY_YEAR = 0xFFFF;          // Year field is 16 bits of the key
+const int MAX_KEY_MONTH = 0xFF;           // Month field is 8 bits of the key
+const uint64_t MONTH_AND_TITLE_BITS = ((uint64_t)1 << 48) - 1;  // Below year
+const uint64_t TITLE_BITS = ((uint64_t)1 << 40) - 1;            // Below month
 
 // ----------------------------------------------------------------------------
 // Default Constructor
 // Initializes periodical with 1 copy and default month
-// Periodical object created with 1 available copy
-Periodical::Periodical() : month(DEFAULT_MONTH) {
+// Periodical object created with 1 available copy, strings interned in pool
+Periodical::Periodical(StringPool* pool)
+    : Publication(PERIODICAL_CODE, pool), month(DEFAULT_MONTH) {
     copies = PERIODICAL_COPIES;
 }
 
@@ -39,27 +44,53 @@ Periodical::~Periodical() = default;
 // Reads periodical data from input stream in format: title, month year
 // Periodical object populated with data from stream
 void Periodical::setData(istream& in) {
-    getline(in >> ws, title, ',');        // Read title until comma
+    title = readField(in);                // Read title until comma
     in >> month >> year;                  // Read month and year as integers
+    updateSortKey();
+}
+
+// ----------------------------------------------------------------------------
+// setData (line slice)
+// Parses "title, month year" directly from data without a stream
+// Periodical object populated, title interned in the pool
+void Periodical::setData(string_view data) {
+    setData(MediaRecord::parse(PERIODICAL_CODE, data));
+}
+
+// ----------------------------------------------------------------------------
+// setData (record)
+// Copies parsed fields, interning strings in the pool
+// Periodical object populated from record
+void Periodical::setData(const MediaRecord& record) {
+    title = pool->intern(record.title);
+    month = record.month;
+    year = record.year;
+    updateSortKey();
+}
+
+// ----------------------------------------------------------------------------
+// getRecord
+// Returns record viewing title, month and year (no author)
+MediaRecord Periodical::getRecord() const {
+    return MediaRecord{PERIODICAL_CODE, string_view(), title, month, year};
 }
 
 // ----------------------------------------------------------------------------
 // display
 // Outputs periodical information in formatted columns
-// Periodical data written to stream in tabular format
-void Periodical::display(ostream& out) const {
-    out << left << setw(AVAIL_WIDTH) << copies
-        << setw(TITLE_WIDTH) << title.substr(0, MAX_TITLE_DISPLAY)
-        << right << setw(MONTH_WIDTH) << month
-        << setw(YEAR_WIDTH) << year << endl;
+// Periodical data appended to sink in tabular format
+void Periodical::display(OutputSink& out) const {
+    out.writeLeft(copies, AVAIL_WIDTH)
+       .writeLeft(title.substr(0, MAX_TITLE_DISPLAY), TITLE_WIDTH)
+       .writeRight(month, MONTH_WIDTH)
+       .writeRight(year, YEAR_WIDTH) << '\n';
 }
 
 // ----------------------------------------------------------------------------
 // operator==
 // Returns true if both are periodicals with same title, year, and month
 bool Periodical::operator==(const Media& other) const {
-    const Periodical* p = dynamic_cast<const Periodical*>(&other);
-    return p && title == p->title && year == p->year && month == p->month;
+    return other.getType() == PERIODICAL_CODE && compareTo(other) == 0;
 }
 
 // ----------------------------------------------------------------------------
@@ -67,17 +98,61 @@ bool Periodical::operator==(const Media& other) const {
 // Compares periodicals for sorting (year first, then month, then title)
 // Returns true if this periodical should sort before other
 bool Periodical::operator<(const Media& other) const {
-    const Periodical* p = dynamic_cast<const Periodical*>(&other);
-    if (!p) return false;
-    
+    return other.getType() == PERIODICAL_CODE && compareTo(other) < 0;
+}
+
+// ----------------------------------------------------------------------------
+// getKey
+// Returns lookup key viewing year, month and title (valid while this lives)
+MediaKey Periodical::getKey() const {
+    return MediaKey{PERIODICAL_CODE, sortKey, string_view(), title, month, year};
+}
+
+// ----------------------------------------------------------------------------
+// compareFields
+// Full comparison by year, month, then title; only reached when keys match
+// Returns negative, zero or positive; non-periodical keys never compare equal
+int Periodical::compareFields(const MediaKey& key) const {
+    if (key.type != PERIODICAL_CODE) return 1;
+
     // Sort by year first, then month, then title
-    if (year != p->year) {
-        return year < p->year;
+    if (year != key.year) {
+        return year < key.year ? -1 : 1;
+    }
+    if (month != key.month) {
+        return month < key.month ? -1 : 1;
     }
-    if (month != p->month) {
-        return month < p->month;
+    return compareStrings(title, key.title);
+}
+
+// ----------------------------------------------------------------------------
+// makeSortKey
+// Packs year (16 bits), month (8 bits) and a 5-byte title prefix into one
+// integer. A field out of range saturates itself and every field after it
+// (zeros below, ones above), so clamped keys only ever tie with their
+// neighbours and the tie falls back to compareFields
+uint64_t Periodical::makeSortKey(int year, int month, string_view title) {
+    if (year < 0) {
+        return 0;
     }
-    return title < p->title;
+    if (year > MAX_KEY_YEAR) {
+        return ((uint64_t)MAX_KEY_YEAR << 48) | MONTH_AND_TITLE_BITS;
+    }
+    uint64_t key = (uint64_t)year << 48;
+    if (month < 0) {
+        return key;
+    }
+    if (month > MAX_KEY_MONTH) {
+        return key | ((uint64_t)MAX_KEY_MONTH << 40) | TITLE_BITS;
+    }
+    return key | ((uint64_t)month << 40) | (packPrefix(title, "") >> 24);
+}
+
+// ----------------------------------------------------------------------------
+// updateSortKey
+// Recomputes sort key after year, month or title changes
+void Periodical::updateSortKey() {
+    sortKey = makeSortKey(year, month, title);
 }
 
 // ----------------------------------------------------------------------------
@@ -85,7 +160,7 @@ bool Periodical::operator<(const Media& other) const {
 // Factory method to create new Periodical object
 // Returns pointer to new Periodical object
 Media* Periodical::create() const {
-    return new Periodical();
+    return new Periodical(pool);
 }
 
 // ----------------------------------------------------------------------------
@@ -93,11 +168,12 @@ Media* Periodical::create() const {
 // Creates deep copy of this Periodical object
 // Returns pointer to new Periodical with same data
 Media* Periodical::clone() const {
-    Periodical* p = new Periodical();
+    Periodical* p = new Periodical(pool);
     p->title = this->title;
     p->year = this->year;
     p->month = this->month;
     p->copies = this->copies;
+    p->sortKey = this->sortKey;
     // Note: Periodicals don't have authors
     return p;
 }
\ No newline at end of file
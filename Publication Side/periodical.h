@@ -16,18 +16,27 @@
 class Periodical : public Publication {
 public:
 
-    // Default Constructor
-    Periodical();
+    // Default Constructor, strings interned in pool
+    Periodical(StringPool* pool = StringPool::getDefault());
     
     // Destructor
     virtual ~Periodical();
 
     // Reads periodical data from input stream (title, month, year)
     virtual void setData(istream& in) override;
+
+    // Reads periodical data from a line slice in the same format
+    virtual void setData(string_view data) override;
+
+    // Sets periodical data from a parsed record
+    virtual void setData(const MediaRecord& record) override;
+
+    // Returns record viewing title, month and year
+    virtual MediaRecord getRecord() const override;
     
 
     // Outputs periodical data in formatted columns
-    virtual void display(ostream& out) const override;
+    virtual void display(OutputSink& out) const override;
 
 
     // Compares periodicals for equality (same title, month, and year)
@@ -37,6 +46,15 @@ public:
     // Compares for sorting by year, then month, then title
     virtual bool operator<(const Media& other) const override;
 
+    // Returns lookup key viewing this periodical's identity fields
+    virtual MediaKey getKey() const override;
+
+    // Full three-way comparison used when sort keys collide
+    virtual int compareFields(const MediaKey& key) const override;
+
+    // Builds the sort key: year and month packed above a title prefix
+    static uint64_t makeSortKey(int year, int month, string_view title);
+
     // Factory method to create new Periodical object
     virtual Media* create() const override;
     
@@ -44,6 +62,10 @@ public:
     // Creates deep copy of this Periodical object
     virtual Media* clone() const override;
 
+protected:
+    // Recomputes sort key from year, month and title
+    virtual void updateSortKey() override;
+
 private:
     int month;           // Publication month (1-12)
 };
@@ -14,12 +14,14 @@
 // Constants
 const int DEFAULT_YEAR = 0;
 const int MIN_COPIES = 0;
+const int KEY_BYTES = 8;
 
 // ----------------------------------------------------------------------------
-// Default Constructor
-// Initializes data members to default values
-// Object created with empty strings and zero values
-Publication::Publication() : author(""), title(""), year(DEFAULT_YEAR), copies(MIN_COPIES) {
+// Constructor
+// Initializes data members to default values, tags object with type code
+// Object created with empty strings (interned in pool) and zero values
+Publication::Publication(char typeCode, StringPool* pool)
+    : Media(typeCode), pool(pool), year(DEFAULT_YEAR), copies(MIN_COPIES) {
 }
 
 // ----------------------------------------------------------------------------  
@@ -32,7 +34,9 @@ Publication::~Publication() = default;
 // Sets the author name for this publication
 // author data member updated
 void Publication::setAuthor(const string& a) {
-    author = a;
+    author = pool->intern(a);
+    updateSortKey();
+    markRowDirty();
 }
 
 // ----------------------------------------------------------------------------
@@ -40,7 +44,9 @@ void Publication::setAuthor(const string& a) {
 // Sets the title for this publication
 // title data member updated
 void Publication::setTitle(const string& t) {
-    title = t;
+    title = pool->intern(t);
+    updateSortKey();
+    markRowDirty();
 }
 
 // ----------------------------------------------------------------------------
@@ -49,6 +55,8 @@ void Publication::setTitle(const string& t) {
 // year data member updated  
 void Publication::setYear(int y) {
     year = y;
+    updateSortKey();
+    markRowDirty();
 }
 
 // ----------------------------------------------------------------------------
@@ -57,6 +65,7 @@ void Publication::setYear(int y) {
 // copies data member updated
 void Publication::setCopies(int c) {
     copies = c;
+    markRowDirty();
 }
 
 // ----------------------------------------------------------------------------
@@ -64,7 +73,7 @@ void Publication::setCopies(int c) {
 // Returns the author name
 // Returns current author string
 string Publication::getAuthor() const {
-    return author;
+    return string(author.data(), author.size());
 }
 
 // ----------------------------------------------------------------------------
@@ -72,7 +81,7 @@ string Publication::getAuthor() const {
 // Returns the publication title  
 // Returns current title string
 string Publication::getTitle() const {
-    return title;
+    return string(title.data(), title.size());
 }
 
 // ----------------------------------------------------------------------------
@@ -91,20 +100,72 @@ int Publication::getCopies() const {
     return copies;
 }
 
+// ----------------------------------------------------------------------------
+// getRecord
+// Returns record viewing this publication's fields
+MediaRecord Publication::getRecord() const {
+    return MediaRecord{getType(), author, title, 0, year};
+}
+
 // ----------------------------------------------------------------------------
 // increaseCopies
 // Increments the available copy count by one
-// copies increased by 1
+// copies increased by 1, cached display row marked dirty
 void Publication::increaseCopies() {
     ++copies;
+    markRowDirty();
 }
 
 // ----------------------------------------------------------------------------
 // decreaseCopies
 // Decrements the available copy count by one, minimum of 0
-// copies decreased by 1, never goes below 0
+// copies decreased by 1, never goes below 0; row marked dirty on change
 void Publication::decreaseCopies() {
     if (copies > MIN_COPIES) {
         --copies;
+        markRowDirty();
     }
-}
\ No newline at end of file
+}
+
+// ----------------------------------------------------------------------------
+// readField
+// Reads text up to the next comma (skipping leading whitespace)
+// Returns interned view of the field
+string_view Publication::readField(istream& in) {
+    string field;
+    getline(in >> ws, field, ',');
+    return pool->intern(field);
+}
+
+// ----------------------------------------------------------------------------
+// packPrefix
+// Packs the bytes of first, a NUL separator, then second into a 64-bit
+// big-endian prefix. Unsigned integer order of results matches ordering
+// of (first, second) pairs; equal results need a full compare
+uint64_t Publication::packPrefix(string_view first, string_view second) {
+    uint64_t key = 0;
+    int packed = 0;
+    for (size_t i = 0; i < first.size() && packed < KEY_BYTES; ++i, ++packed) {
+        key = (key << 8) | (unsigned char)first[i];
+    }
+    if (packed < KEY_BYTES) {
+        key <<= 8;                    // NUL separator sorts below any char
+        packed++;
+    }
+    for (size_t i = 0; i < second.size() && packed < KEY_BYTES; ++i, ++packed) {
+        key = (key << 8) | (unsigned char)second[i];
+    }
+    return key << (8 * (KEY_BYTES - packed));
+}
+
+// ----------------------------------------------------------------------------
+// compareStrings
+// Three-way comparison of two strings
+// Returns -1, 0 or 1 as a sorts before, equal to or after b
+int Publication::compareStrings(string_view a, string_view b) {
+    if (a.data() == b.data() && a.size() == b.size()) {
+        return 0;                     // Same pooled string
+    }
+    int result = a.compare(b);
+    return (result > 0) - (result < 0);
+}
@@ -7,6 +7,7 @@
  Author: Sharjeel Khan
  Assumptions: All publications have title and year. Only Fiction and 
               Children's publications have authors.
+              The string pool outlives every publication interned in it
 -----------------------------------------------------------------------------
 */
 
@@ -14,22 +15,26 @@
 #define PUBLICATION_H
 
 #include "media.h"
+#include "stringPool.h"
 #include <string>
 #include <iostream>
+#include <string_view>
 
 using namespace std;
 
 class Publication : public Media {
 protected:
-    string author;                    // Author name (empty for periodicals)
-    string title;                     // Publication title
+    StringPool* pool;                 // Pool author and title are interned in
+    string_view author;               // Author name (empty for periodicals)
+    string_view title;                // Publication title
     int year;                         // Year of publication
     int copies;                       // Number of available copies
 
 public:
 
-    // Default Constructor
-    Publication();
+    // Constructor taking the derived type code, strings are interned in
+    // the given pool
+    Publication(char typeCode, StringPool* pool = StringPool::getDefault());
     
     // Ensures proper cleanup of derived classes
     virtual ~Publication();
@@ -38,7 +43,7 @@ public:
     void setAuthor(const string& a);
     void setTitle(const string& t);
     void setYear(int y);
-    void setCopies(int c);
+    void setCopies(int c) override;
     
    
     // Accessor methods
@@ -48,20 +53,42 @@ public:
     int getCopies() const override;
     
     // copies incremented by 1
-    void increaseCopies();
+    void increaseCopies() override;
     
 
     // copies decremented by 1
-    void decreaseCopies();
+    void decreaseCopies() override;
     
 
     // Pure virtual functions - must be implemented by derived classes
     virtual void setData(istream& in) = 0;
-    virtual void display(ostream& out) const = 0;
+    virtual void setData(string_view data) = 0;
+    virtual void setData(const MediaRecord& record) = 0;
+
+    // Returns record viewing author, title and year (month left zero)
+    virtual MediaRecord getRecord() const override;
+    virtual void display(OutputSink& out) const = 0;
     virtual bool operator==(const Media& other) const = 0;
     virtual bool operator<(const Media& other) const = 0;
+    virtual MediaKey getKey() const = 0;
+    virtual int compareFields(const MediaKey& key) const = 0;
     virtual Media* create() const = 0;
     virtual Media* clone() const = 0;
+
+protected:
+    // Recomputes sortKey from the current fields
+    virtual void updateSortKey() = 0;
+
+    // Reads comma-terminated field from stream and interns it
+    string_view readField(istream& in);
+
+    // Packs first, a NUL separator, then second into 8 big-endian bytes so
+    // unsigned comparison of the result follows string ordering of the pair
+    static uint64_t packPrefix(string_view first, string_view second);
+
+    // Three-way string comparison returning -1, 0 or 1; interned views
+    // of the same text compare equal without touching the characters
+    static int compareStrings(string_view a, string_view b);
 };
 
 #endif // PUBLICATION_H
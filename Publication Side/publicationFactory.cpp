@@ -22,19 +22,56 @@ const char PERIODICAL_CODE = 'P';
 // Factory method to create publication objects based on type code
 // Returns pointer to new publication object or nullptr for invalid type
 // Error message displayed for invalid codes
-Media* PublicationFactory::createPublication(char type) const {
+Media* PublicationFactory::createPublication(char type, Arena* arena,
+                                             StringPool* pool) const {
+    if (pool == nullptr) {
+        pool = StringPool::getDefault();
+    }
+    if (arena != nullptr) {
+        switch (type) {
+            case FICTION_CODE:
+                return new (arena->allocate(sizeof(Fiction), alignof(Fiction))) Fiction(pool);
+
+            case CHILDREN_CODE:
+                return new (arena->allocate(sizeof(Children), alignof(Children))) Children(pool);
+
+            case PERIODICAL_CODE:
+                return new (arena->allocate(sizeof(Periodical), alignof(Periodical))) Periodical(pool);
+
+            default:
+                break;
+        }
+    }
+
     switch (type) {
         case FICTION_CODE:
-            return new Fiction();
+            return new Fiction(pool);
             
         case CHILDREN_CODE:
-            return new Children();
+            return new Children(pool);
             
         case PERIODICAL_CODE:
-            return new Periodical();
+            return new Periodical(pool);
             
         default:
             cout << "ERROR: '" << type << "' is not a valid LibItem type." << endl;
             return nullptr;
     }
+}
+
+// ----------------------------------------------------------------------------
+// destroyPublication
+// Disposes of a publication created by createPublication that no container
+// took ownership of (e.g. a rejected duplicate)
+// Heap publications deleted; arena publications destroyed in place, their
+// memory returns when the arena is released
+void PublicationFactory::destroyPublication(Media* publication, Arena* arena) const {
+    if (publication == nullptr) {
+        return;
+    }
+    if (arena != nullptr) {
+        publication->~Media();
+    } else {
+        delete publication;
+    }
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 #define PUBLICATION_FACTORY_H
 
 #include "media.h"
+#include "arena.h"
 #include "fiction.h"
 #include "children.h"
 #include "periodical.h"
@@ -29,8 +30,14 @@ public:
     ~PublicationFactory() = default;
 
 
-    // Creates new Media object based on publication type code
-    Media* createPublication(char type) const;
+    // Creates new Media object based on publication type code, placed in
+    // arena when one is given, strings interned in pool (default pool
+    // when none is given)
+    Media* createPublication(char type, Arena* arena = nullptr,
+                             StringPool* pool = nullptr) const;
+
+    // Disposes of a publication that was never handed to a container
+    void destroyPublication(Media* publication, Arena* arena = nullptr) const;
 };
 
 #endif // PUBLICATION_FACTORY_H
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+-----------------------------------------------------------------------------
+ File: rowCache.cpp
+ Description: Implementation of RowCache. Rows are rendered through an
+              OutputSink into a string stream, so cached text is exactly
+              what Media::display would write.
+ Author: Sharjeel Khan
+ Assumptions: Row lengths only change when a field outgrows its column
+-----------------------------------------------------------------------------
+*/
+
+#include "rowCache.h"
+#include "mediaTree.h"
+#include <sstream>
+
+// ----------------------------------------------------------------------------
+// Constructor
+// Cache starts stale, nothing rendered yet
+RowCache::RowCache() : valid(false) {
+}
+
+// ----------------------------------------------------------------------------
+// display
+// Brings rows up to date, then appends the whole block
+// Rows for every item in tree appended to out
+void RowCache::display(const MediaTree& tree, OutputSink& out) {
+    if (!valid || !refresh()) {
+        rebuild(tree);
+    }
+    out << text;
+}
+
+// ----------------------------------------------------------------------------
+// markDirty
+// Queues row once; ignored while the cache is stale since a rebuild
+// renders everything anyway
+void RowCache::markDirty(uint32_t row) {
+    if (!valid || row >= queued.size() || queued[row]) {
+        return;
+    }
+    queued[row] = true;
+    dirty.push_back(row);
+}
+
+// ----------------------------------------------------------------------------
+// invalidate
+// Forces a full render on the next display
+void RowCache::invalidate() {
+    valid = false;
+    dirty.clear();
+}
+
+// ----------------------------------------------------------------------------
+// rebuild
+// Renders all items in one pass, recording where each row starts
+// Cache valid, every item attached to its row
+void RowCache::rebuild(const MediaTree& tree) {
+    items.clear();
+    tree.collectAll(items);
+    offsets.resize(items.size() + 1);
+
+    ostringstream rendered;
+    {
+        OutputSink sink(rendered);
+        for (size_t i = 0; i < items.size(); ++i) {
+            offsets[i] = sink.getWritten();
+            items[i]->display(sink);
+            items[i]->attachRow(this, (uint32_t)i);
+        }
+        offsets[items.size()] = sink.getWritten();
+    }
+    text = rendered.str();
+
+    dirty.clear();
+    queued.assign(items.size(), false);
+    valid = true;
+}
+
+// ----------------------------------------------------------------------------
+// refresh
+// Renders each dirty row and copies it over the old one
+// Returns true if all rows kept their length
+bool RowCache::refresh() {
+    ostringstream rendered;
+    for (uint32_t row : dirty) {
+        queued[row] = false;
+        rendered.str("");
+        {
+            OutputSink sink(rendered);
+            items[row]->display(sink);
+        }
+        string line = rendered.str();
+        if (line.size() != offsets[row + 1] - offsets[row]) {
+            return false;
+        }
+        text.replace(offsets[row], line.size(), line);
+    }
+    dirty.clear();
+    return true;
+}
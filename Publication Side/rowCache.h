@@ -0,0 +1,66 @@
+/*
+-----------------------------------------------------------------------------
+ File: rowCache.h
+ Description: Pre-rendered display rows for one catalog tree. The first
+              display renders every item once into a single text block;
+              later displays copy that block and re-render only the rows
+              whose items reported a change (copies checked out or
+              returned), so repeated listings of an unchanged catalog are
+              a straight copy.
+ Author: Sharjeel Khan
+ Assumptions: Items attached to the cache call markDirty when their
+              displayed fields change
+              The owner calls invalidate whenever the tree gains items
+              Uses about as much memory as the rendered listing
+-----------------------------------------------------------------------------
+*/
+
+#ifndef ROWCACHE_H
+#define ROWCACHE_H
+
+#include "outputSink.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class Media;
+class MediaTree;
+
+class RowCache {
+public:
+    // Creates an empty cache that renders on first display
+    RowCache();
+
+    // Appends rows of tree in sorted order to out, rendering everything
+    // if the cache is stale and only dirty rows otherwise
+    void display(const MediaTree& tree, OutputSink& out);
+
+    // Queues row for re-rendering on the next display
+    void markDirty(uint32_t row);
+
+    // Drops cached rows so the next display renders the whole tree
+    void invalidate();
+
+private:
+    string text;                      // All rows, in tree order
+    vector<Media*> items;             // Item rendered in each row
+    vector<size_t> offsets;           // Start of each row in text, plus end
+    vector<uint32_t> dirty;           // Rows to re-render
+    vector<bool> queued;              // Whether each row is already in dirty
+    bool valid;                       // Rows match the tree
+
+    // Renders every item of tree and attaches each to its row
+    void rebuild(const MediaTree& tree);
+
+    // Re-renders dirty rows in place; returns false if a row changed
+    // length and the block has to be rebuilt
+    bool refresh();
+
+    // Rows are tied to one tree, copying is not supported
+    RowCache(const RowCache&) = delete;
+    RowCache& operator=(const RowCache&) = delete;
+};
+
+#endif // ROWCACHE_H
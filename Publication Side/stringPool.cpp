@@ -0,0 +1,169 @@
+/*
+-----------------------------------------------------------------------------
+ File: stringPool.cpp
+ Description: Implementation of StringPool. Distinct strings are copied
+              into arena slabs and found again through an open-addressed
+              table that caches each string's hash.
+ Author: Sharjeel Khan
+ Assumptions: Table load factor is kept at or below 1/2
+-----------------------------------------------------------------------------
+*/
+
+#include "stringPool.h"
+#include "mediaHash.h"
+#include <cstring>
+
+using namespace std;
+
+// ----------------------------------------------------------------------------
+// Default Constructor
+// Initializes empty pool with a small lookup table
+StringPool::StringPool()
+    : storage(STORAGE_SLAB_SIZE), slots(new Slot[INITIAL_CAPACITY]()),
+      capacity(INITIAL_CAPACITY), count(0), lookups(0), hits(0),
+      bytesStored(0), bytesSaved(0) {
+}
+
+// ----------------------------------------------------------------------------
+// Destructor
+// Frees lookup table, arena frees the pooled characters
+StringPool::~StringPool() {
+    delete[] slots;
+}
+
+// ----------------------------------------------------------------------------
+// getDefault
+// Returns pool shared by publications created without an explicit pool
+StringPool* StringPool::getDefault() {
+    static StringPool defaultPool;
+    return &defaultPool;
+}
+
+// ----------------------------------------------------------------------------
+// intern
+// Finds text in the pool, copying it into storage when absent
+// Returns view into pool storage (empty view for empty text)
+string_view StringPool::intern(string_view text) {
+    return lookup(text, true);
+}
+
+// ----------------------------------------------------------------------------
+// adopt
+// Finds text in the pool, pooling the caller's bytes when absent
+// Returns pooled view (empty view for empty text)
+string_view StringPool::adopt(string_view text) {
+    return lookup(text, false);
+}
+
+// ----------------------------------------------------------------------------
+// lookup
+// Probes table for text; absent text is added, copied into storage when
+// copy is set and referenced in place otherwise
+// Returns pooled view (empty view for empty text)
+string_view StringPool::lookup(string_view text, bool copy) {
+    if (text.empty()) {
+        return string_view();
+    }
+    lookups++;
+
+    uint64_t hash = MediaHash::hashString(text);
+    size_t mask = capacity - 1;
+    size_t i = hash & mask;
+    for (; slots[i].text.data() != nullptr; i = (i + 1) & mask) {
+        if (slots[i].hash == hash && slots[i].text == text) {
+            hits++;
+            bytesSaved += text.size();
+            return slots[i].text;
+        }
+    }
+
+    // New string - claim the empty slot
+    slots[i].hash = hash;
+    if (copy) {
+        char* stored = static_cast<char*>(storage.allocate(text.size(), 1));
+        memcpy(stored, text.data(), text.size());
+        slots[i].text = string_view(stored, text.size());
+        bytesStored += text.size();
+    } else {
+        slots[i].text = text;
+    }
+    count++;
+
+    string_view pooled = slots[i].text;
+    if (count * 2 > capacity) {
+        grow();
+    }
+    return pooled;
+}
+
+// ----------------------------------------------------------------------------
+// getLookups
+// Returns number of non-empty intern requests
+size_t StringPool::getLookups() const {
+    return lookups;
+}
+
+// ----------------------------------------------------------------------------
+// getHits
+// Returns number of requests answered by an existing copy
+size_t StringPool::getHits() const {
+    return hits;
+}
+
+// ----------------------------------------------------------------------------
+// getUniqueCount
+// Returns number of distinct strings pooled
+size_t StringPool::getUniqueCount() const {
+    return count;
+}
+
+// ----------------------------------------------------------------------------
+// getBytesStored
+// Returns bytes copied into pool storage
+size_t StringPool::getBytesStored() const {
+    return bytesStored;
+}
+
+// ----------------------------------------------------------------------------
+// getBytesSaved
+// Returns bytes of intern requests that were hits
+size_t StringPool::getBytesSaved() const {
+    return bytesSaved;
+}
+
+// ----------------------------------------------------------------------------
+// displayStats
+// Shows pool statistics for analysis
+// Lookup, hit rate and memory figures displayed
+void StringPool::displayStats(OutputSink& out) const {
+    out << "String Pool Statistics:\n";
+    out << "Distinct strings: " << count << '\n';
+    out << "Intern lookups: " << lookups << '\n';
+    if (lookups > 0) {
+        out << "Hit rate: " << (double)hits * 100 / lookups << "%\n";
+    }
+    out << "Bytes stored: " << bytesStored << '\n';
+    out << "Bytes saved: " << bytesSaved << '\n';
+}
+
+// ----------------------------------------------------------------------------
+// grow
+// Doubles table capacity and reinserts entries using their cached hashes
+void StringPool::grow() {
+    Slot* oldSlots = slots;
+    size_t oldCapacity = capacity;
+
+    capacity *= 2;
+    slots = new Slot[capacity]();
+    size_t mask = capacity - 1;
+    for (size_t j = 0; j < oldCapacity; ++j) {
+        if (oldSlots[j].text.data() != nullptr) {
+            size_t i = oldSlots[j].hash & mask;
+            while (slots[i].text.data() != nullptr) {
+                i = (i + 1) & mask;
+            }
+            slots[i] = oldSlots[j];
+        }
+    }
+    delete[] oldSlots;
+}
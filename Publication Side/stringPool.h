@@ -0,0 +1,89 @@
+/*
+-----------------------------------------------------------------------------
+ File: stringPool.h
+ Description: Interning pool for publication strings. Each distinct author
+              or title is stored once and every publication holds a
+              string_view into the pool, so a prolific author or a
+              periodical title repeated for every issue costs one copy.
+              Interned views of equal text share the same address, which
+              lets field comparisons short-circuit on pointer equality.
+ Author: Sharjeel Khan
+ Assumptions: Interned views stay valid for the lifetime of the pool
+              Pool is used from one thread at a time
+-----------------------------------------------------------------------------
+*/
+
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include "arena.h"
+#include "outputSink.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+using namespace std;
+
+class StringPool {
+public:
+    // Creates empty pool
+    StringPool();
+
+    // Frees the lookup table; character storage is freed with the arena
+    ~StringPool();
+
+    // Returns pooled view equal to text, copying text in on first sight
+    string_view intern(string_view text);
+
+    // Like intern, but a new string is pooled in place instead of copied;
+    // text must stay valid for the pool's lifetime (e.g. a mapped file)
+    string_view adopt(string_view text);
+
+    // Number of intern requests and how many found an existing copy
+    size_t getLookups() const;
+    size_t getHits() const;
+
+    // Number of distinct strings and the bytes they occupy
+    size_t getUniqueCount() const;
+    size_t getBytesStored() const;
+
+    // Bytes not copied because the text was already pooled
+    size_t getBytesSaved() const;
+
+    // Appends pool usage statistics to out
+    void displayStats(OutputSink& out) const;
+
+    // Process-wide pool for publications created without one
+    static StringPool* getDefault();
+
+private:
+    static const size_t INITIAL_CAPACITY = 256;   // Must be a power of two
+    static const size_t STORAGE_SLAB_SIZE = 64 * 1024;
+
+    struct Slot {
+        uint64_t hash;                // Cached hash of text
+        string_view text;             // Pooled text, null data if empty slot
+    };
+
+    Arena storage;                    // Character data of pooled strings
+    Slot* slots;                      // Open-addressed lookup table
+    size_t capacity;                  // Number of slots (power of two)
+    size_t count;                     // Distinct strings pooled
+    size_t lookups;                   // Non-empty intern requests
+    size_t hits;                      // Requests answered by existing copy
+    size_t bytesStored;               // Bytes copied into storage (adopted
+                                      // strings are not counted)
+    size_t bytesSaved;                // Bytes of requests that were hits
+
+    // Finds or adds text, copying new text into storage if copy is set
+    string_view lookup(string_view text, bool copy);
+
+    // Doubles the table and reinserts every entry
+    void grow();
+
+    // Pool hands out views into its own storage, copying is not supported
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+};
+
+#endif // STRINGPOOL_H
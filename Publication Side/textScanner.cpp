@@ -0,0 +1,139 @@
+/*
+-----------------------------------------------------------------------------
+ File: textScanner.cpp
+ Description: Implementation of TextScanner helpers. Numbers are parsed
+              with from_chars, which never allocates or consults a locale.
+ Author: Sharjeel Khan
+ Assumptions: Text is ASCII; whitespace is tested with isspace
+-----------------------------------------------------------------------------
+*/
+
+#include "textScanner.h"
+#include <cctype>
+#include <charconv>
+
+using namespace std;
+
+// Constants
+const size_t MIN_CHUNK_BYTES = 64 * 1024;   // Below this a thread isn't worth it
+
+// ----------------------------------------------------------------------------
+// skipSpace
+// Drops leading whitespace from text
+void TextScanner::skipSpace(string_view& text) {
+    size_t i = 0;
+    while (i < text.size() && isspace((unsigned char)text[i])) {
+        ++i;
+    }
+    text.remove_prefix(i);
+}
+
+// ----------------------------------------------------------------------------
+// takeField
+// Removes and returns text up to the next comma, consuming the comma
+// Whole text returned when there is no comma
+string_view TextScanner::takeField(string_view& text) {
+    size_t comma = text.find(',');
+    string_view field = text.substr(0, comma);
+    text.remove_prefix(comma == string_view::npos ? text.size() : comma + 1);
+    return field;
+}
+
+// ----------------------------------------------------------------------------
+// takeWord
+// Skips whitespace, then removes and returns characters up to the next
+// whitespace character (which is left in text)
+string_view TextScanner::takeWord(string_view& text) {
+    skipSpace(text);
+    size_t end = 0;
+    while (end < text.size() && !isspace((unsigned char)text[end])) {
+        ++end;
+    }
+    string_view word = text.substr(0, end);
+    text.remove_prefix(end);
+    return word;
+}
+
+// ----------------------------------------------------------------------------
+// takeLine
+// Removes and returns text up to the next newline, consuming the newline
+// Whole text returned when there is no newline
+string_view TextScanner::takeLine(string_view& text) {
+    size_t newline = text.find('\n');
+    string_view line = text.substr(0, newline);
+    text.remove_prefix(newline == string_view::npos ? text.size() : newline + 1);
+    return line;
+}
+
+// ----------------------------------------------------------------------------
+// takeChar
+// Skips whitespace and takes one character
+// Returns true with c set, or false with c '\0' if text is exhausted
+bool TextScanner::takeChar(string_view& text, char& c) {
+    skipSpace(text);
+    if (text.empty()) {
+        c = '\0';
+        return false;
+    }
+    c = text.front();
+    text.remove_prefix(1);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// takeInteger
+// Shared body of the takeInt overloads: skips whitespace and parses a
+// decimal integer of type T
+// Returns true with value set, or false with value 0 if no number present
+template <typename T>
+static bool takeInteger(string_view& text, T& value) {
+    TextScanner::skipSpace(text);
+    value = 0;
+    // Streams accept an explicit plus sign, from_chars does not
+    size_t sign = text.size() > 1 && text[0] == '+' && isdigit((unsigned char)text[1]) ? 1 : 0;
+    from_chars_result result = from_chars(text.data() + sign, text.data() + text.size(), value);
+    if (result.ec != errc()) {
+        value = 0;
+        return false;
+    }
+    text.remove_prefix(result.ptr - text.data());
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// takeInt (int)
+bool TextScanner::takeInt(string_view& text, int& value) {
+    return takeInteger(text, value);
+}
+
+// ----------------------------------------------------------------------------
+// takeInt (64-bit)
+bool TextScanner::takeInt(string_view& text, int64_t& value) {
+    return takeInteger(text, value);
+}
+
+// ----------------------------------------------------------------------------
+// splitChunks
+// Cuts text at the first newline after each evenly spaced target offset
+// Returns chunks in text order covering all of text
+vector<string_view> TextScanner::splitChunks(string_view text, int count) {
+    vector<string_view> chunks;
+    size_t maxChunks = text.size() / MIN_CHUNK_BYTES + 1;
+    size_t chunkCount = count < 1 ? 1 : (size_t)count;
+    if (chunkCount > maxChunks) {
+        chunkCount = maxChunks;
+    }
+
+    size_t target = text.size() / chunkCount;
+    while (!text.empty()) {
+        if (chunks.size() + 1 == chunkCount) {
+            chunks.push_back(text);
+            break;
+        }
+        size_t newline = text.find('\n', target == 0 ? 0 : target - 1);
+        size_t end = newline == string_view::npos ? text.size() : newline + 1;
+        chunks.push_back(text.substr(0, end));
+        text.remove_prefix(end);
+    }
+    return chunks;
+}
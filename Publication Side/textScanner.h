@@ -0,0 +1,56 @@
+/*
+-----------------------------------------------------------------------------
+ File: textScanner.h
+ Description: Delimiter scanning over string_view slices. Each helper
+              consumes from the front of a view and returns a slice of the
+              same buffer, so data files and command lines are parsed in
+              place without istringstream, locale lookups or copies.
+              Helpers mirror the stream operations the parsers used before
+              (>> ws, getline on a delimiter, >> int, >> string).
+ Author: Sharjeel Khan
+ Assumptions: Returned slices are only valid while the scanned buffer lives
+-----------------------------------------------------------------------------
+*/
+
+#ifndef TEXTSCANNER_H
+#define TEXTSCANNER_H
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+class TextScanner {
+public:
+    // Drops leading whitespace (same as istream >> ws)
+    static void skipSpace(string_view& text);
+
+    // Removes and returns text up to the next comma, consuming the comma
+    // (same as getline on ','); whole text returned when there is none
+    static string_view takeField(string_view& text);
+
+    // Skips whitespace, removes and returns the next run of non-space
+    // characters (same as istream >> string)
+    static string_view takeWord(string_view& text);
+
+    // Removes and returns text up to the next newline, consuming it
+    // (same as getline)
+    static string_view takeLine(string_view& text);
+
+    // Skips whitespace, removes and returns the next character (same as
+    // istream >> char). Returns false and sets c to '\0' at end of text
+    static bool takeChar(string_view& text, char& c);
+
+    // Skips whitespace and parses a decimal integer (same as istream >> int
+    // or int64_t). Returns false and sets value to 0 if no number is present
+    static bool takeInt(string_view& text, int& value);
+    static bool takeInt(string_view& text, int64_t& value);
+
+    // Splits text into at most count consecutive chunks of similar size,
+    // each ending just after a newline (or at the end of text), so every
+    // line falls entirely inside one chunk. Small texts get fewer chunks
+    static vector<string_view> splitChunks(string_view text, int count);
+};
+
+#endif // TEXTSCANNER_H
@@ -0,0 +1,112 @@
+/*
+-----------------------------------------------------------------------------
+ File: binTreeStress.cpp
+ Description: Stress run for BinTree on its worst-case input. Inserts N
+              periodicals in ascending order (the order that used to
+              degrade the tree into a list and overflow the stack on
+              teardown), then looks every one up, walks the tree in order
+              through display, and destroys it. Prints the time of each
+              phase, the tree height bound and the peak RSS.
+ Build: g++ -std=c++17 -O2 -I"Publication Side" bench/binTreeStress.cpp
+            "Publication Side"/[a-z]*.cpp -o binTreeStress
+ Usage: binTreeStress [nodes]        (default 10000000)
+ Author: Sharjeel Khan
+ Assumptions: Linux (peak RSS from getrusage); 10M nodes peak at about 2.5 GB
+-----------------------------------------------------------------------------
+*/
+
+#include "bintree.h"
+#include "periodical.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/resource.h>
+
+using namespace std;
+
+// Constants
+const long DEFAULT_NODES = 10000000;
+const int ISSUES_PER_YEAR = 1000;     // Titles within one year, then the year
+                                      // advances so keys stay ascending
+const int FIRST_YEAR = 1000;
+
+// Seconds elapsed since start
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Peak resident set size of this process in MB
+static double peakRssMb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+}
+
+// Title of issue i, zero-padded so titles sort like their numbers
+static string issueTitle(long i) {
+    char title[32];
+    snprintf(title, sizeof(title), "Issue %09ld", i);
+    return title;
+}
+
+int main(int argc, char* argv[]) {
+    long nodes = argc > 1 ? atol(argv[1]) : DEFAULT_NODES;
+    if (nodes <= 0) {
+        printf("Usage: %s [nodes]\n", argv[0]);
+        return 1;
+    }
+
+    BinTree* tree = new BinTree();
+
+    // Ascending inserts: every new key goes to the far right of the tree
+    auto start = chrono::steady_clock::now();
+    for (long i = 0; i < nodes; ++i) {
+        string title = issueTitle(i);
+        Periodical* periodical = new Periodical();
+        periodical->setData(MediaRecord{'P', string_view(), title, 1,
+                                        (int)(FIRST_YEAR + i / ISSUES_PER_YEAR)});
+        if (!tree->insert(periodical)) {
+            printf("ERROR: insert %ld rejected\n", i);
+            return 1;
+        }
+    }
+    double insertSeconds = secondsSince(start);
+
+    // Every key looked up once, in insertion order
+    start = chrono::steady_clock::now();
+    long found = 0;
+    for (long i = 0; i < nodes; ++i) {
+        string title = issueTitle(i);
+        Periodical target;
+        target.setData(MediaRecord{'P', string_view(), title, 1,
+                                   (int)(FIRST_YEAR + i / ISSUES_PER_YEAR)});
+        Media* match = nullptr;
+        found += tree->retrieve(target, match) ? 1 : 0;
+    }
+    double retrieveSeconds = secondsSince(start);
+
+    // Full in-order walk, output discarded
+    start = chrono::steady_clock::now();
+    {
+        ofstream discard("/dev/null");
+        OutputSink out(discard);
+        tree->display(out);
+    }
+    double displaySeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    delete tree;
+    double destroySeconds = secondsSince(start);
+
+    printf("BinTree stress: %ld ascending periodicals\n", nodes);
+    printf("AVL height bound: %.0f levels\n", 1.44 * log2((double)nodes + 2));
+    printf("insert:   %8.2f s\n", insertSeconds);
+    printf("retrieve: %8.2f s (%ld found)\n", retrieveSeconds, found);
+    printf("display:  %8.2f s\n", displaySeconds);
+    printf("destroy:  %8.2f s\n", destroySeconds);
+    printf("peak RSS: %8.0f MB\n", peakRssMb());
+    return found == nodes ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+/*
+-----------------------------------------------------------------------------
+ File: catalogBench.cpp
+ Description: Compares the BinTree and BPlusTree catalog backends. For
+              each size, N fiction titles are inserted in shuffled order,
+              every title is looked up by key in a different shuffled
+              order, and the whole catalog is scanned twice: once into a
+              vector (collectAll) and once through display into a
+              discarded sink. Prints one row per backend and size.
+ Build: g++ -std=c++17 -O2 -I"Publication Side" bench/catalogBench.cpp
+            "Publication Side"/[a-z]*.cpp -o catalogBench
+ Usage: catalogBench [sizes...]      (default 100000 1000000 10000000)
+ Author: Sharjeel Khan
+ Assumptions: The 10M row needs about 3 GB of memory per backend
+-----------------------------------------------------------------------------
+*/
+
+#include "bintree.h"
+#include "bplustree.h"
+#include "fiction.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Constants
+const long DEFAULT_SIZES[] = {100000, 1000000, 10000000};
+const long AUTHOR_COUNT = 50000;      // Titles spread over this many authors
+const unsigned SEED = 12345;
+
+// Seconds elapsed since start
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Creates count distinct fiction titles in shuffled order
+static vector<Media*> makeCatalog(long count, mt19937& rng) {
+    vector<Media*> items;
+    items.reserve(count);
+    char author[32];
+    char title[32];
+    for (long i = 0; i < count; ++i) {
+        snprintf(author, sizeof(author), "Author %06ld", i % AUTHOR_COUNT);
+        snprintf(title, sizeof(title), "Title %09ld", i);
+        Fiction* fiction = new Fiction();
+        fiction->setData(MediaRecord{'F', author, title, 0, 2000});
+        items.push_back(fiction);
+    }
+    shuffle(items.begin(), items.end(), rng);
+    return items;
+}
+
+// Runs every phase on one backend and prints its row
+static void runBackend(const char* name, MediaTree* tree, long count) {
+    mt19937 rng(SEED);
+    vector<Media*> items = makeCatalog(count, rng);
+
+    auto start = chrono::steady_clock::now();
+    for (Media* item : items) {
+        tree->insert(item);
+    }
+    double insertSeconds = secondsSince(start);
+
+    shuffle(items.begin(), items.end(), rng);
+    start = chrono::steady_clock::now();
+    long found = 0;
+    for (const Media* item : items) {
+        Media* match = nullptr;
+        found += tree->retrieve(item->getKey(), match) ? 1 : 0;
+    }
+    double retrieveSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    vector<Media*> all;
+    all.reserve(count);
+    tree->collectAll(all);
+    double collectSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+    {
+        ofstream discard("/dev/null");
+        OutputSink out(discard);
+        tree->display(out);
+    }
+    double displaySeconds = secondsSince(start);
+
+    printf("%-8s %10ld %10.3f %10.1f %10.3f %10.3f%s\n", name, count, insertSeconds,
+           retrieveSeconds * 1e9 / count, collectSeconds, displaySeconds,
+           found == count && (long)all.size() == count ? "" : "  (MISMATCH)");
+    delete tree;                      // Trees own their Media
+}
+
+int main(int argc, char* argv[]) {
+    vector<long> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(atol(argv[i]));
+    }
+    if (sizes.empty()) {
+        sizes.assign(begin(DEFAULT_SIZES), end(DEFAULT_SIZES));
+    }
+
+    printf("%-8s %10s %10s %10s %10s %10s\n", "backend", "titles", "insert s",
+           "lookup ns", "collect s", "display s");
+    for (long count : sizes) {
+        runBackend("BinTree", new BinTree(), count);
+        runBackend("BPlus", new BPlusTree(), count);
+    }
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*
+-----------------------------------------------------------------------------
+ File: clientHashBench.cpp
+ Description: Compares the client table storage policies. For each policy
+              and size, N clients with shuffled IDs are inserted, every ID
+              is looked up in a different shuffled order (hits), and the
+              same number of absent IDs are looked up (misses). Prints one
+              row per policy and size, with the resident memory the
+              clients and table added. Each row runs in its own child
+              process so one policy's heap does not affect the next.
+              Policies and the build flag that selects each in ClientManager:
+                chained    - ChainedClientStorage, SSSS_CHAINED_CLIENT_HASH
+                flat       - FlatClientStorage, the default
+                compact    - CompactClientStorage, SSSS_COMPACT_CLIENT_HASH
+                concurrent - ConcurrentClientStorage,
+                             SSSS_CONCURRENT_CLIENT_HASH
+ Build: g++ -std=c++17 -O2 -I"Client Side" -I"Publication Side"
+            bench/clientHashBench.cpp "Client Side"/[a-z]*.cpp
+            "Publication Side"/[a-z]*.cpp -o clientHashBench
+ Usage: clientHashBench [sizes...]   (default 10000 1000000 10000000)
+ Author: Sharjeel Khan
+ Assumptions: Linux (fork, RSS from /proc/self/statm); DirectClientStorage
+              only holds 4-digit IDs, so it is not part of the comparison
+-----------------------------------------------------------------------------
+*/
+
+#include "clientHash.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+
+// Constants
+const long DEFAULT_SIZES[] = {10000, 1000000, 10000000};
+const ClientID FIRST_ID = 1000;
+const int NAME_COUNT = 5000;          // Distinct names, so the name pool
+                                      // stays small next to the table
+const unsigned SEED = 12345;
+
+// Seconds elapsed since start
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Resident set size of this process in MB
+static double residentMb() {
+    long pages = 0;
+    long resident = 0;
+    ifstream statm("/proc/self/statm");
+    statm >> pages >> resident;
+    return resident * (double)sysconf(_SC_PAGESIZE) / (1024 * 1024);
+}
+
+// Inserts count clients, looks up hits and misses, prints the row
+template <typename Storage>
+static void runPolicy(const char* name, long count) {
+    mt19937_64 rng(SEED);
+    vector<ClientID> ids(count);
+    for (long i = 0; i < count; ++i) {
+        ids[i] = FIRST_ID + i;
+    }
+    shuffle(ids.begin(), ids.end(), rng);
+
+    // Names interned before the baseline, so RSS covers clients and table
+    char lastName[NAME_COUNT][16];
+    char firstName[NAME_COUNT][16];
+    for (int i = 0; i < NAME_COUNT; ++i) {
+        snprintf(lastName[i], sizeof(lastName[i]), "Last%d", i);
+        snprintf(firstName[i], sizeof(firstName[i]), "First%d", i);
+        ClientNamePool::getDefault().intern(lastName[i]);
+        ClientNamePool::getDefault().intern(firstName[i]);
+    }
+
+    // Clients are created as they are inserted, as the loader does, so
+    // policies that copy them reuse the freed objects
+    double baseMb = residentMb();
+    ClientHash<Storage> table;
+    auto start = chrono::steady_clock::now();
+    for (ClientID id : ids) {
+        table.insert(new Client(id, firstName[id / 7 % NAME_COUNT], lastName[id % NAME_COUNT]));
+    }
+    double insertSeconds = secondsSince(start);
+    double tableMb = residentMb() - baseMb;
+
+    shuffle(ids.begin(), ids.end(), rng);
+    long found = 0;
+    start = chrono::steady_clock::now();
+    for (ClientID id : ids) {
+        Client* client = nullptr;
+        found += table.retrieve(id, client) ? 1 : 0;
+    }
+    double hitSeconds = secondsSince(start);
+
+    // Absent IDs: above the inserted range, same count
+    long missed = 0;
+    start = chrono::steady_clock::now();
+    for (ClientID id : ids) {
+        Client* client = nullptr;
+        missed += table.retrieve(id + count, client) ? 0 : 1;
+    }
+    double missSeconds = secondsSince(start);
+
+    printf("%-10s %10ld %10.3f %10.1f %10.1f %10.1f %10.1f%s\n", name, count, insertSeconds,
+           hitSeconds * 1e9 / count, missSeconds * 1e9 / count, tableMb,
+           tableMb * 1024 * 1024 / count,
+           found == count && missed == count && (long)table.size() == count ? ""
+                                                                           : "  (MISMATCH)");
+    fflush(stdout);
+}
+
+// Runs runPolicy<Storage> in a child process and waits for it
+template <typename Storage>
+static bool runIsolated(const char* name, long count) {
+    pid_t child = fork();
+    if (child == 0) {
+        runPolicy<Storage>(name, count);
+        _exit(0);
+    }
+    int status = 0;
+    if (child < 0 || waitpid(child, &status, 0) < 0 || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != 0) {
+        printf("ERROR: %s run with %ld clients failed\n", name, count);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    vector<long> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(atol(argv[i]));
+    }
+    if (sizes.empty()) {
+        sizes.assign(begin(DEFAULT_SIZES), end(DEFAULT_SIZES));
+    }
+
+    printf("%-10s %10s %10s %10s %10s %10s %10s\n", "policy", "clients", "insert s",
+           "hit ns", "miss ns", "RSS MB", "B/client");
+    fflush(stdout);
+    bool ok = true;
+    for (long count : sizes) {
+        ok = runIsolated<ChainedClientStorage>("chained", count) && ok;
+        ok = runIsolated<FlatClientStorage>("flat", count) && ok;
+        ok = runIsolated<CompactClientStorage>("compact", count) && ok;
+        ok = runIsolated<ConcurrentClientStorage>("concurrent", count) && ok;
+    }
+    return ok ? 0 : 1;
+}
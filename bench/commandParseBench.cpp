@@ -0,0 +1,135 @@
+/*
+-----------------------------------------------------------------------------
+ File: commandParseBench.cpp
+ Description: Microbenchmark of command line parsing. Parses the same mix
+              of checkout, return, history and display lines with
+              ParsedCommand::parse and with the istringstream path the
+              commands used before it (operator>> for the leading fields,
+              then getline for the publication data), and prints commands
+              parsed per second for each. Both paths must agree on every
+              field, which is checked once before timing.
+ Build: g++ -std=c++17 -O2 -I"Command Side" -I"Publication Side"
+            bench/commandParseBench.cpp "Command Side/parsedCommand.cpp"
+            "Publication Side/textScanner.cpp" -o commandParseBench
+ Usage: commandParseBench [passes]   (default 200 passes over 10000 lines)
+ Author: Sharjeel Khan
+ Assumptions: The stream path is a copy of the removed setData code, kept
+              here only as the reference
+-----------------------------------------------------------------------------
+*/
+
+#include "parsedCommand.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Constants
+const int DEFAULT_PASSES = 200;
+const int LINE_COUNT = 10000;
+
+// Fields both paths produce
+struct Fields {
+    char code;
+    int64_t clientID;
+    char publicationType;
+    char formatType;
+    string data;
+};
+
+// Stream path, as CheckoutCommand::setData parsed lines before
+static bool parseWithStream(const string& line, Fields& fields) {
+    istringstream iss(line);
+    fields.clientID = 0;
+    fields.publicationType = 0;
+    fields.formatType = 0;
+    if (!(iss >> fields.code >> fields.clientID >> fields.publicationType >> fields.formatType)) {
+        return false;
+    }
+    getline(iss >> ws, fields.data);
+    return true;
+}
+
+// Single-pass path; fields view the line
+static bool parseInPlace(string_view line, Fields& fields) {
+    ParsedCommand parsed = ParsedCommand::parse(line);
+    fields.code = parsed.code;
+    fields.clientID = parsed.clientID;
+    fields.publicationType = parsed.publicationType;
+    fields.formatType = parsed.formatType;
+    return parsed.fields == 4;
+}
+
+// Mix of the command forms found in data4commands.txt
+static vector<string> makeLines() {
+    const char* templates[] = {
+        "C %d F H Kerouac Jack, On the Road,",
+        "R %d C H Charlie and the Chocolate Factory, Dahl Roald,",
+        "C %d P H 2009 3 Communications of the ACM,",
+        "R %d F H Danny Dunn & the Homework Machine, Williams Jay,",
+        "H %d",
+        "D",
+    };
+    const int templateCount = sizeof(templates) / sizeof(templates[0]);
+
+    vector<string> lines;
+    char line[128];
+    for (int i = 0; i < LINE_COUNT; ++i) {
+        snprintf(line, sizeof(line), templates[i % templateCount], 1000 + i % 9000);
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+// Times passes over lines with parse, returns commands per second
+template <typename Parse>
+static double commandsPerSecond(const vector<string>& lines, int passes, Parse parse,
+                                long& checksum) {
+    Fields fields;
+    auto start = chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (const string& line : lines) {
+            checksum += parse(line, fields) ? fields.clientID + fields.code : 0;
+        }
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return (double)lines.size() * passes / seconds;
+}
+
+int main(int argc, char* argv[]) {
+    int passes = argc > 1 ? atoi(argv[1]) : DEFAULT_PASSES;
+    vector<string> lines = makeLines();
+
+    // Both paths must read the same leading fields
+    for (const string& line : lines) {
+        Fields expected, actual;
+        bool streamOk = parseWithStream(line, expected);
+        bool inPlaceOk = parseInPlace(line, actual);
+        if (streamOk != inPlaceOk || (streamOk && (expected.code != actual.code ||
+                                                    expected.clientID != actual.clientID ||
+                                                    expected.publicationType != actual.publicationType ||
+                                                    expected.formatType != actual.formatType))) {
+            printf("ERROR: parsers disagree on \"%s\"\n", line.c_str());
+            return 1;
+        }
+    }
+
+    long streamChecksum = 0;
+    long inPlaceChecksum = 0;
+    double stream = commandsPerSecond(lines, passes, parseWithStream, streamChecksum);
+    double inPlace = commandsPerSecond(lines, passes,
+                                       [](const string& line, Fields& fields) {
+                                           return parseInPlace(line, fields);
+                                       },
+                                       inPlaceChecksum);
+
+    printf("Parsed %ld command lines per path\n", (long)lines.size() * passes);
+    printf("istringstream:        %8.2f M commands/s\n", stream / 1e6);
+    printf("ParsedCommand::parse: %8.2f M commands/s\n", inPlace / 1e6);
+    printf("speedup:              %8.1fx\n", inPlace / stream);
+    return streamChecksum == inPlaceChecksum ? 0 : 1;
+}
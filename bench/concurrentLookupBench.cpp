@@ -0,0 +1,227 @@
+/*
+-----------------------------------------------------------------------------
+ File: concurrentLookupBench.cpp
+ Description: Measures how lookups on the concurrent client table scale
+              with reader threads. Preloads ClientHash with
+              ConcurrentClientStorage (SSSS_CONCURRENT_CLIENT_HASH), then
+              for 1, 2, 4, ... reader threads runs random lookups, each in
+              its own ReadGuard, for a fixed time. Every thread count runs
+              twice: readers alone, then readers next to one writer that
+              keeps removing and reinserting clients. Prints total lookups
+              per second and the speedup over one reader for both runs.
+              Then runs 1, 2, 4, ... writer threads inserting and removing
+              disjoint IDs through ClientManager, the path the library
+              uses, and prints writes per second and the speedup.
+ Build: g++ -std=c++17 -O2 -pthread -DSSSS_CONCURRENT_CLIENT_HASH
+            -I"Client Side" -I"Publication Side"
+            bench/concurrentLookupBench.cpp "Client Side"/[a-z]*.cpp
+            "Publication Side"/[a-z]*.cpp -o concurrentLookupBench
+ Usage: concurrentLookupBench [clients] [maxThreads] [seconds]
+        (defaults 1000000, hardware threads but at least 8, 1.0)
+ Author: Sharjeel Khan
+ Assumptions: Speedup is bounded by the hardware threads printed first
+              The writer only touches the top CHURN_CLIENTS IDs, which
+              readers also look up, so some of their lookups miss
+              Under ThreadSanitizer, run with TSAN_OPTIONS=detect_deadlocks=0;
+              a table resize holds more locks than its detector tracks
+-----------------------------------------------------------------------------
+*/
+
+#include "clientManager.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+using ConcurrentTable = ClientHash<ConcurrentClientStorage>;
+static_assert(is_same<ClientTable, ConcurrentTable>::value,
+              "build with -DSSSS_CONCURRENT_CLIENT_HASH");
+
+// Constants
+const long DEFAULT_CLIENTS = 1000000;
+const int MIN_MAX_THREADS = 8;
+const double DEFAULT_SECONDS = 1.0;
+const ClientID FIRST_ID = 1000;
+const long CHURN_CLIENTS = 1000;      // IDs the writer removes and reinserts
+const int LOOKUPS_PER_CHECK = 1024;   // Lookups between checks of the stop flag
+const long MAX_WRITER_CLIENTS = 200000;   // Clients each writer run inserts
+                                         // and removes, over all threads
+
+// Small per-thread generator; keeps the lookup loop free of shared state
+static uint64_t nextRandom(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+// Looks up random IDs until stop is set, returns lookups done
+static long readLoop(const ConcurrentTable& table, long clients, unsigned seed,
+                     const atomic<bool>& stop, long& found) {
+    uint64_t state = 0x9e3779b97f4a7c15ULL * (seed + 1);
+    long lookups = 0;
+    while (!stop.load(memory_order_relaxed)) {
+        for (int i = 0; i < LOOKUPS_PER_CHECK; ++i) {
+            ClientID id = FIRST_ID + (ClientID)(nextRandom(state) % clients);
+            ConcurrentTable::ReadGuard guard(table);
+            Client* client = nullptr;
+            found += table.retrieve(id, client) ? 1 : 0;
+        }
+        lookups += LOOKUPS_PER_CHECK;
+    }
+    return lookups;
+}
+
+// Removes and reinserts the churn IDs until stop is set
+static void writeLoop(ConcurrentTable& table, long clients, const atomic<bool>& stop) {
+    long churnStart = clients > CHURN_CLIENTS ? clients - CHURN_CLIENTS : 0;
+    while (!stop.load(memory_order_relaxed)) {
+        for (long i = churnStart; i < clients; ++i) {
+            ClientID id = FIRST_ID + i;
+            table.remove(id);
+            table.insert(new Client(id, "Churn", "Writer"));
+        }
+    }
+}
+
+// Runs threads readers for seconds, returns lookups per second
+static double measure(ConcurrentTable& table, long clients, int threads, double seconds,
+                      bool withWriter, bool& sawMiss) {
+    atomic<bool> stop(false);
+    vector<long> lookups(threads, 0);
+    vector<long> found(threads, 0);
+    vector<thread> readers;
+    thread writer;
+    if (withWriter) {
+        writer = thread(writeLoop, ref(table), clients, cref(stop));
+    }
+    auto start = chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        readers.emplace_back([&, t] {
+            lookups[t] = readLoop(table, clients, t, stop, found[t]);
+        });
+    }
+    this_thread::sleep_for(chrono::duration<double>(seconds));
+    stop.store(true);
+    for (thread& reader : readers) {
+        reader.join();
+    }
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    if (writer.joinable()) {
+        writer.join();
+    }
+
+    long total = 0;
+    for (int t = 0; t < threads; ++t) {
+        total += lookups[t];
+        sawMiss = sawMiss || found[t] != lookups[t];
+    }
+    return total / elapsed;
+}
+
+// Inserts then removes count clients from first on, returns failures
+static long writeThrough(ClientManager& manager, ClientID first, long count) {
+    long failures = 0;
+    for (long i = 0; i < count; ++i) {
+        Client* client = new Client(first + i, "Writer", "Manager");
+        if (!manager.insert(client)) {
+            delete client;
+            failures++;
+        }
+    }
+    for (long i = 0; i < count; ++i) {
+        failures += manager.remove(first + i) ? 0 : 1;
+    }
+    return failures;
+}
+
+// Runs threads writers inserting and removing clients through a fresh
+// ClientManager, returns writes per second (inserts plus removes)
+static double measureWriters(long clients, int threads, bool& failed) {
+    ClientManager manager;
+    long perThread = clients / threads;
+    vector<long> failures(threads, 0);
+    vector<thread> writers;
+    auto start = chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        writers.emplace_back([&, t] {
+            failures[t] = writeThrough(manager, FIRST_ID + t * perThread, perThread);
+        });
+    }
+    for (thread& writer : writers) {
+        writer.join();
+    }
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    for (long count : failures) {
+        failed = failed || count != 0;
+    }
+    vector<Client*> inTable;
+    vector<Client> inIndex;
+    manager.collectAll(inTable);
+    manager.findByLastNamePrefix("", inIndex);
+    failed = failed || !inTable.empty() || !inIndex.empty();
+    return 2.0 * perThread * threads / elapsed;
+}
+
+int main(int argc, char* argv[]) {
+    long clients = argc > 1 ? atol(argv[1]) : DEFAULT_CLIENTS;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : (int)thread::hardware_concurrency();
+    double seconds = argc > 3 ? atof(argv[3]) : DEFAULT_SECONDS;
+    if (argc <= 2 && maxThreads < MIN_MAX_THREADS) {
+        maxThreads = MIN_MAX_THREADS;
+    }
+    if (clients <= 0 || maxThreads <= 0 || seconds <= 0) {
+        printf("Usage: %s [clients] [maxThreads] [seconds]\n", argv[0]);
+        return 1;
+    }
+
+    ConcurrentTable table;
+    for (long i = 0; i < clients; ++i) {
+        table.insert(new Client(FIRST_ID + i, "First", "Last"));
+    }
+
+    printf("Lookups on %ld clients, %.1f s per run (%u hardware threads)\n", clients,
+           seconds, thread::hardware_concurrency());
+    printf("%8s %14s %8s %14s %8s\n", "readers", "lookups/s", "speedup", "+writer /s",
+           "speedup");
+
+    bool ok = true;
+    double baseline = 0;
+    double writerBaseline = 0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        bool readMiss = false;
+        bool writerMiss = false;
+        double rate = measure(table, clients, threads, seconds, false, readMiss);
+        double writerRate = measure(table, clients, threads, seconds, true, writerMiss);
+        if (threads == 1) {
+            baseline = rate;
+            writerBaseline = writerRate;
+        }
+        printf("%8d %14.0f %8.2f %14.0f %8.2f%s\n", threads, rate, rate / baseline,
+               writerRate, writerRate / writerBaseline, readMiss ? "  (MISS)" : "");
+        ok = ok && !readMiss;
+    }
+    ok = ok && (long)table.size() == clients;
+
+    long writerClients = clients < MAX_WRITER_CLIENTS ? clients : MAX_WRITER_CLIENTS;
+    printf("\nWriters through ClientManager, %ld clients inserted and removed\n",
+           writerClients);
+    printf("%8s %14s %8s\n", "writers", "writes/s", "speedup");
+    double writeBaseline = 0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        bool failed = false;
+        double rate = measureWriters(writerClients, threads, failed);
+        if (threads == 1) {
+            writeBaseline = rate;
+        }
+        printf("%8d %14.0f %8.2f%s\n", threads, rate, rate / writeBaseline,
+               failed ? "  (MISMATCH)" : "");
+        ok = ok && !failed;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+/*
+-----------------------------------------------------------------------------
+ File: loadScaling.cpp
+ Description: Measures how Library::initialize scales with loadThreads.
+              Writes a generated publications file and clients file, then
+              loads them into a fresh Library once per thread count
+              (1, 2, 4, ... up to the maximum) and prints load time and
+              speedup over one thread. Every run must load the same
+              totals, so a mismatch is reported.
+ Build: g++ -std=c++17 -O2 -pthread -I"Client Side" -I"Command Side"
+            -IInterface -I"Publication Side" bench/loadScaling.cpp
+            "Client Side"/[a-z]*.cpp "Command Side"/[a-z]*.cpp
+            "Publication Side"/[a-z]*.cpp Interface/library.cpp
+            Interface/mappedFile.cpp Interface/compressedReader.cpp
+            -lz -o loadScaling
+ Usage: loadScaling [publications] [clients] [maxThreads]
+        (defaults 1000000, 200000, hardware threads but at least 8)
+ Author: Sharjeel Khan
+ Assumptions: Generated files go to the system temp directory and are
+              removed afterwards
+-----------------------------------------------------------------------------
+*/
+
+#include "library.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+using namespace std;
+
+// Constants
+const long DEFAULT_PUBLICATIONS = 1000000;
+const long DEFAULT_CLIENTS = 200000;
+const int MIN_MAX_THREADS = 8;
+const long FIRST_CLIENT_ID = 1000;
+
+// Writes publications lines cycling through children, fiction and periodicals
+static void writePublications(const string& path, long count) {
+    ofstream file(path);
+    for (long i = 0; i < count; ++i) {
+        switch (i % 3) {
+            case 0:
+                file << "C Author" << i % 5000 << " Writer, Picture Book " << i << ", "
+                     << 1950 + i % 70 << '\n';
+                break;
+            case 1:
+                file << "F Novelist" << i % 20000 << " Pen, Novel Number " << i << ", "
+                     << 1900 + i % 120 << '\n';
+                break;
+            default:
+                file << "P Journal " << i << ", " << 1 + i % 12 << ' ' << 1980 + i % 40 << '\n';
+                break;
+        }
+    }
+}
+
+// Writes client lines "ID lastName firstName" with distinct IDs
+static void writeClients(const string& path, long count) {
+    ofstream file(path);
+    for (long i = 0; i < count; ++i) {
+        file << FIRST_CLIENT_ID + i << " Last" << i % 7000 << " First" << i % 3000 << '\n';
+    }
+}
+
+int main(int argc, char* argv[]) {
+    long publications = argc > 1 ? atol(argv[1]) : DEFAULT_PUBLICATIONS;
+    long clients = argc > 2 ? atol(argv[2]) : DEFAULT_CLIENTS;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : (int)thread::hardware_concurrency();
+    if (argc <= 3 && maxThreads < MIN_MAX_THREADS) {
+        maxThreads = MIN_MAX_THREADS;
+    }
+
+    filesystem::path directory = filesystem::temp_directory_path();
+    string publicationFile = (directory / "loadScaling_pubs.txt").string();
+    string clientFile = (directory / "loadScaling_clients.txt").string();
+    writePublications(publicationFile, publications);
+    writeClients(clientFile, clients);
+
+    printf("Loading %ld publications and %ld clients (%u hardware threads)\n",
+           publications, clients, thread::hardware_concurrency());
+    printf("%8s %10s %8s\n", "threads", "seconds", "speedup");
+
+    double baseline = 0;
+    string baselineSummary;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        // Library reports progress on cout; keep it out of the table
+        ostringstream captured;
+        streambuf* original = cout.rdbuf(captured.rdbuf());
+        auto start = chrono::steady_clock::now();
+        bool loaded;
+        {
+            Library library(BINARY_TREE_BACKEND, false, threads);
+            loaded = library.initialize(publicationFile, clientFile);
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout.rdbuf(original);
+
+        string summary = captured.str();
+        if (threads == 1) {
+            baseline = seconds;
+            baselineSummary = summary;
+        }
+        printf("%8d %10.3f %8.2f%s\n", threads, seconds, baseline / seconds,
+               !loaded ? "  (LOAD FAILED)" : summary != baselineSummary ? "  (MISMATCH)" : "");
+    }
+
+    filesystem::remove(publicationFile);
+    filesystem::remove(clientFile);
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+-----------------------------------------------------------------------------
+ File: periodicalSortKeyTest.cpp
+ Description: Checks that Periodical sort keys preserve (year, month,
+              title) order, including years and months outside the bits
+              the key has for them. For every ordered pair of sample
+              periodicals the first key must not exceed the second; equal
+              keys are fine, since the trees fall back to compareFields.
+              Also loads the samples into a BinTree and checks the in-order
+              walk against a plain field sort.
+ Build: g++ -std=c++17 -O2 -I"Publication Side" tests/periodicalSortKeyTest.cpp
+            "Publication Side"/[a-z]*.cpp -o periodicalSortKeyTest
+ Author: Sharjeel Khan
+ Assumptions: Exit status is 0 when every check passes
+-----------------------------------------------------------------------------
+*/
+
+#include "bintree.h"
+#include "periodical.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+
+struct Sample {
+    int year;
+    int month;
+    string title;
+};
+
+// Field order used by Periodical::compareFields
+static bool fieldLess(const Sample& a, const Sample& b) {
+    return tie(a.year, a.month, a.title) < tie(b.year, b.month, b.title);
+}
+
+int main() {
+    const int YEARS[] = {-5, -1, 0, 1, 2001, 65534, 65535, 65536, 70000};
+    const int MONTHS[] = {-3, -1, 0, 1, 12, 254, 255, 256, 300};
+    const string TITLES[] = {"", "A", "Time", "Times Weekly", "Zebra", "\xff\xff\xff\xff\xff\xff"};
+
+    vector<Sample> samples;
+    for (int year : YEARS) {
+        for (int month : MONTHS) {
+            for (const string& title : TITLES) {
+                samples.push_back(Sample{year, month, title});
+            }
+        }
+    }
+
+    // Keys never invert field order
+    int failures = 0;
+    for (const Sample& a : samples) {
+        uint64_t keyA = Periodical::makeSortKey(a.year, a.month, a.title);
+        for (const Sample& b : samples) {
+            if (fieldLess(a, b) && keyA > Periodical::makeSortKey(b.year, b.month, b.title)) {
+                if (failures++ < 10) {
+                    cout << "FAIL: key order inverted for (" << a.year << ", " << a.month
+                         << ", \"" << a.title << "\") < (" << b.year << ", " << b.month
+                         << ", \"" << b.title << "\")" << endl;
+                }
+            }
+        }
+    }
+
+    // Tree order matches field order end to end
+    BinTree tree;
+    for (const Sample& sample : samples) {
+        Periodical* periodical = new Periodical();
+        periodical->setData(MediaRecord{'P', string_view(), sample.title, sample.month,
+                                        sample.year});
+        if (!tree.insert(periodical)) {
+            delete periodical;
+        }
+    }
+    vector<Media*> walked;
+    tree.collectAll(walked);
+    vector<Sample> expected = samples;
+    sort(expected.begin(), expected.end(), fieldLess);
+    if (walked.size() != expected.size()) {
+        cout << "FAIL: tree holds " << walked.size() << " of " << expected.size() << endl;
+        failures++;
+    } else {
+        for (size_t i = 0; i < walked.size(); ++i) {
+            MediaRecord fields = walked[i]->getRecord();
+            if (fields.year != expected[i].year || fields.month != expected[i].month ||
+                fields.title != expected[i].title) {
+                cout << "FAIL: tree position " << i << " holds (" << fields.year << ", "
+                     << fields.month << ", \"" << fields.title << "\")" << endl;
+                failures++;
+                break;
+            }
+        }
+    }
+
+    if (failures > 0) {
+        cout << failures << " check(s) failed" << endl;
+        return 1;
+    }
+    cout << "All " << samples.size() << " periodical sort key checks passed" << endl;
+    return 0;
+}